@@ -722,6 +722,27 @@
   // FIND YOUR OWN: "M303 E-1 C8 S90" to run autotune on the bed at 90 degreesC for 8 cycles.
 #endif // PIDTEMPBED
 
+/**
+ * Model Predictive Control for bed
+ *
+ * Use a physical model of the bed to control temperature, as with MPCTEMP for hotends.
+ * The model accounts for the lag between the heater and the sensor so large beds can reach
+ * the target without overshoot. With a chamber sensor the chamber temperature is used as the
+ * ambient temperature of the model. Use M306 T E-1 to autotune the model.
+ */
+//#define MPCTEMPBED     // ** EXPERIMENTAL **
+
+#if ENABLED(MPCTEMPBED)
+  #define MPC_BED_HEATER_POWER 250.0f                 // (W) Bed heater power.
+
+  // Measured physical constants from M306 T E-1
+  #define MPC_BED_BLOCK_HEAT_CAPACITY 600.0f          // (J/K) Bed plate heat capacity.
+  #define MPC_BED_SENSOR_RESPONSIVENESS 0.05f         // (K/s per ∆K) Rate of change of sensor temperature from bed plate.
+  #define MPC_BED_AMBIENT_XFER_COEFF 1.5f             // (W/K) Heat transfer coefficient from bed plate to room air.
+
+  #define MPC_BED_TUNING_TEMP 90                      // (°C) M306 T E-1 heats the bed past this temperature.
+#endif
+
 //===========================================================================
 //==================== PID > Chamber Temperature Control ====================
 //===========================================================================
@@ -766,6 +787,25 @@
   // FIND YOUR OWN: "M303 E-2 C8 S50" to run autotune on the chamber at 50 degreesC for 8 cycles.
 #endif // PIDTEMPCHAMBER
 
+/**
+ * Model Predictive Control for chamber
+ *
+ * Use a physical model of the chamber heater to control temperature, as with MPCTEMP.
+ * Use M306 T E-2 to autotune the model.
+ */
+//#define MPCTEMPCHAMBER // ** EXPERIMENTAL **
+
+#if ENABLED(MPCTEMPCHAMBER)
+  #define MPC_CHAMBER_HEATER_POWER 200.0f             // (W) Chamber heater power.
+
+  // Measured physical constants from M306 T E-2
+  #define MPC_CHAMBER_BLOCK_HEAT_CAPACITY 3000.0f     // (J/K) Chamber air and walls heat capacity.
+  #define MPC_CHAMBER_SENSOR_RESPONSIVENESS 0.1f      // (K/s per ∆K) Rate of change of sensor temperature from chamber.
+  #define MPC_CHAMBER_AMBIENT_XFER_COEFF 4.0f         // (W/K) Heat transfer coefficient from chamber to room air.
+
+  #define MPC_CHAMBER_TUNING_TEMP 45                  // (°C) M306 T E-2 heats the chamber past this temperature.
+#endif
+
 #if ANY(PIDTEMP, PIDTEMPBED, PIDTEMPCHAMBER)
   //#define PID_DEBUG             // Sends debug data to the serial port. Use 'M303 D' to toggle activation.
   //#define PID_OPENLOOP          // Puts PID in open loop. M104/M140 sets the output power from 0 to PID_MAX
@@ -2044,6 +2084,8 @@
 #if ENABLED(EEPROM_SETTINGS)
   //#define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
   //#define EEPROM_INIT_NOW   // Init EEPROM on first boot after a new build.
+  //#define EEPROM_SECTIONS   // Store settings in sections with their own version and CRC. A firmware
+                              // upgrade only resets the sections that changed. Needs a fresh M500.
 #endif
 
 //
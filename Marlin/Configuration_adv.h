@@ -168,7 +168,7 @@
 //
 // Heated Bed Bang-Bang options
 //
-#if DISABLED(PIDTEMPBED)
+#if NONE(PIDTEMPBED, MPCTEMPBED)
   #define BED_CHECK_INTERVAL 5000   // (ms) Interval between checks in bang-bang control
   #if ENABLED(BED_LIMIT_SWITCHING)
     #define BED_HYSTERESIS 2        // (°C) Only set the relevant heater state when ABS(T-target) > BED_HYSTERESIS
@@ -179,7 +179,7 @@
 //
 // Heated Chamber options
 //
-#if DISABLED(PIDTEMPCHAMBER)
+#if NONE(PIDTEMPCHAMBER, MPCTEMPCHAMBER)
   #define CHAMBER_CHECK_INTERVAL 5000   // (ms) Interval between checks in bang-bang control
   #if ENABLED(CHAMBER_LIMIT_SWITCHING)
     #define CHAMBER_HYSTERESIS 2        // (°C) Only set the relevant heater state when ABS(T-target) > CHAMBER_HYSTERESIS
@@ -341,6 +341,50 @@
   //#define THERMAL_PROTECTION_VARIANCE_MONITOR   // Detect a sensor malfunction preventing temperature updates
 #endif
 
+/**
+ * Hardware PWM Heaters
+ * Drive the hotend, bed, and chamber heaters with hardware timer PWM instead of
+ * switching them in the temperature ISR. The PID / MPC output is passed to the HAL
+ * with HEATER_PWM_RESOLUTION bits instead of 7 and the ISR no longer toggles heater pins.
+ * The resolution the heater gets depends on the HAL and the pin's timer. (The LINUX
+ * simulator scales the duty back to 8 bits.) Not supported on AVR.
+ * Every heater pin must be a hardware PWM pin (check with M43), or Marlin halts at startup,
+ * on a timer not shared with a fan or servo that needs another frequency.
+ * (Fans already use hardware PWM unless FAN_SOFT_PWM is enabled.)
+ */
+//#define HEATER_HARDWARE_PWM
+#if ENABLED(HEATER_HARDWARE_PWM)
+  #define HEATER_PWM_FREQUENCY   50 // (Hz) Keep it low for MOSFETs driven straight from the MCU
+  #define HEATER_PWM_RESOLUTION  10 // (bits) 8-16. Duty resolution requested from the HAL
+#endif
+
+/**
+ * Heater Power Budget
+ * Share one power supply among the hotends, bed, and chamber. Each heater still
+ * requests its own power, but the heater furthest below its target is served first
+ * and the others get what remains, so the total average power stays within HEATER_POWER_LIMIT.
+ * All heaters can then warm up at once without reducing MAX_BED_POWER to protect the PSU.
+ * Only the average over each PWM period is limited. Every heater with some duty switches on
+ * at the start of the period, so the peak draw is still the sum of their wattages.
+ * A heater held back by the budget gets more time to pass its heating watch and thermal
+ * runaway checks, in proportion to the power withheld, and its PID integral is held.
+ * Heaters being autotuned are served before all others, and M303 refuses to tune a heater
+ * that draws more than HEATER_POWER_LIMIT by itself.
+ */
+//#define HEATER_POWER_BUDGET
+
+#if ANY(PIDTEMP, PIDTEMPBED, PIDTEMPCHAMBER)
+  /**
+   * Background PID Autotune
+   * Add 'M303 B' to queue a relay autotune that runs in the background and returns at once,
+   * so the bed, chamber, and every hotend can be tuned at the same time. Jobs wait in the
+   * queue until their heaters fit within HEATER_POWER_LIMIT together with those already tuning,
+   * so a heater that draws more than HEATER_POWER_LIMIT by itself is refused.
+   * Results are reported per heater. 'M303 B E<heater> S0' cancels a job.
+   */
+  //#define PID_AUTOTUNE_CONCURRENT
+#endif
+
 #if ENABLED(PIDTEMP)
   // Add an experimental additional term to the heater power, proportional to the extrusion speed.
   // A well-chosen Kc value should add just enough power to melt the increased material volume.
@@ -401,6 +445,38 @@
   #endif
 #endif
 
+/**
+ * Extrusion Feed-Forward
+ *
+ * Add hotend power ahead of time for the extrusion planned over the next
+ * FEEDFORWARD_LOOKAHEAD_MS, so the melt zone doesn't sag when heavy flow begins.
+ * The planner reports the upcoming volumetric flow from the queued moves, using
+ * the filament diameter and the flow and volumetric multipliers.
+ *  - MPCTEMP uses the MPC filament heat capacity, adding only the flow above the current rate.
+ *  - PIDTEMP uses the filament heat given below and HOTEND_HEATER_WATTS.
+ *    This replaces PID_EXTRUSION_SCALING, which can't be enabled with it.
+ */
+//#define HOTEND_FEEDFORWARD
+#if ENABLED(HOTEND_FEEDFORWARD)
+  #define FEEDFORWARD_LOOKAHEAD_MS     1000 // (ms) How far ahead in the planner to look
+  #if ENABLED(PIDTEMP)
+    #define FEEDFORWARD_FILAMENT_HEAT  0.0022 // (J/K/mm³) Heat capacity per volume of filament. (PLA ~0.0022)
+    #define FEEDFORWARD_AMBIENT_TEMP   25     // (°C) Temperature of the filament entering the hotend
+  #endif
+#endif
+
+/**
+ * Heater Power
+ * The power supply and heater wattages used by HEATER_POWER_BUDGET, by PID_AUTOTUNE_CONCURRENT,
+ * and by HOTEND_FEEDFORWARD with PIDTEMP. MPC heaters use their MPC heater power (M306 P) instead.
+ */
+#if ANY(HEATER_POWER_BUDGET, PID_AUTOTUNE_CONCURRENT, HOTEND_FEEDFORWARD)
+  #define HEATER_POWER_LIMIT    300 // (W) Average power supply capacity available for heaters
+  #define HOTEND_HEATER_WATTS    40 // (W) Power of each hotend heater
+  #define BED_HEATER_WATTS      250 // (W) Power of the bed heater
+  #define CHAMBER_HEATER_WATTS  200 // (W) Power of the chamber heater
+#endif
+
 /**
  * Automatic Temperature Mode
  *
@@ -491,6 +567,18 @@
 #define TEMP_SENSOR_AD8495_OFFSET 0.0
 #define TEMP_SENSOR_AD8495_GAIN   1.0
 
+/**
+ * ADC Scan Sampling
+ * On boards where the HAL scans all ADC channels by DMA, read every channel on each
+ * temperature ISR tick instead of one channel every other tick. Readings go into a ring
+ * and are averaged in readings_ready(), dropping the highest and lowest to reject spikes.
+ * Filament width and power monitor readings are also taken on every tick, so their
+ * filters settle several times faster than with the usual one sensor at a time.
+ * Requires a HAL that samples by DMA scan (STM32F1, SAMD51) or the LINUX simulator.
+ * Not compatible with ADC_KEYPAD.
+ */
+//#define ADC_SCAN_SAMPLING
+
 /**
  * Controller Fan
  * To cool down the stepper drivers and MOSFETs.
@@ -1433,6 +1521,81 @@
 
   //#define GCODE_REPEAT_MARKERS            // Enable G-code M808 to set repeat markers and do looping
 
+  /**
+   * Print heatshrink-compressed G-code files (*.HS, *.GCO) directly from the card.
+   * Use buildroot/share/scripts/gcode_compress.py to create them. Compressed files are
+   * detected by their header and stored as independent blocks, which serve as restart
+   * points for M24 S, M26, M808 and Power-Loss Recovery. All positions are uncompressed.
+   */
+  //#define SD_COMPRESSED_PRINTING
+
+  /**
+   * Read the file being printed into dedicated block buffers, ahead of use.
+   * Contiguous blocks are fetched with multi-block reads from idle(), usually while
+   * the planner is full, instead of one block at a time when the queue needs data.
+   * With STM32 SDIO (DMA) and the LINUX SD image blocks are read in the background
+   * so idle() doesn't wait for the card. Each buffer uses 512 bytes of SRAM.
+   */
+  //#define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_BLOCKS 4          // Number of 512-byte buffers (2-16)
+
+    /**
+     * Copy the file being printed into a large ring cache ahead of the read-ahead buffers.
+     * The card is read in sequential 4K bursts while there is room in the ring, and the
+     * buffers are refilled from the cache. Failed card reads are retried in the background
+     * while the cache drains, riding out brief SD card and USB flash drive hiccups.
+     */
+    //#define SD_PREFETCH_CACHE
+    #if ENABLED(SD_PREFETCH_CACHE)
+      //#define SD_PREFETCH_SPI_FLASH         // Keep the ring in the board's W25Qxx SPI flash. Uses a 4K SRAM staging buffer.
+      #if ENABLED(SD_PREFETCH_SPI_FLASH)
+        #define SD_PREFETCH_FLASH_SIZE 0x100000 // Size of the flash region, in bytes (multiple of 4096)
+        //#define SD_PREFETCH_FLASH_ADDR 0xF00000 // Start of the flash region (4K aligned). Default: The end of the flash.
+                                              // Not for use with TFT_LVGL_UI, which keeps its images and fonts in the flash.
+      #else
+        #define SD_PREFETCH_RAM_SIZE 16384    // Size of the ring in SRAM, in bytes (multiple of 4096)
+      #endif
+    #endif
+  #endif
+
+  /**
+   * Remember the cluster chain of the file being printed as runs of consecutive clusters,
+   * filled in as the file is read. Seeking to any position that has been read (or sought)
+   * before is then a table lookup instead of a walk through the FAT from the start of the
+   * file, making M26 and M808 fast on large files. Power-Loss Recovery also saves the cluster
+   * of the resume position, so the seek to resume after a reboot skips the FAT walk too.
+   * Each run uses 8 bytes of SRAM. Files that need more runs fall back to walking the FAT.
+   */
+  //#define SD_EXTENT_CACHE
+  #if ENABLED(SD_EXTENT_CACHE)
+    #define SD_EXTENT_CACHE_SIZE 32         // Number of runs (fragments) to remember (2-255)
+  #endif
+
+  /**
+   * Collect the data of a file being written (M28, binary file transfer) in block buffers
+   * and write it out in whole blocks with multi-block writes, instead of a partial block
+   * at a time through the shared cache. With protocol 0.2 the binary file transfer host
+   * sends the file size, so all the clusters are allocated at once, up front. If the upload
+   * is cut short by a power loss the file is left empty, and its clusters are freed before the
+   * next file is written. Each buffer uses 512 bytes of SRAM.
+   */
+  //#define SD_WRITE_BEHIND
+  #if ENABLED(SD_WRITE_BEHIND)
+    #define SD_WRITE_BEHIND_BLOCKS 8        // Number of 512-byte buffers (2-16)
+  #endif
+
+  /**
+   * Collect statistics on the read path to find the cause of print stutters: read counts,
+   * a latency histogram, block cache hits and misses, cluster chain (FAT) lookups, and the
+   * rate at which the command queue is fed from the card.
+   *   M39            : Report the statistics
+   *   M39 S<seconds> : Report them periodically (0 to stop)
+   *   M39 R          : Reset them
+   *   M39 B<blocks>  : Benchmark sequential and random reads on the mounted volume
+   */
+  //#define SD_IO_STATS
+
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
@@ -1481,6 +1644,15 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Save the changing state (position, SD position, temperatures, fans) as small records written
+    // in rotation to a preallocated recovery file. A save is then a single block write with no
+    // FAT or directory updates, so it can be done often. The journal is compacted on resume.
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_BLOCKS 8   // 512-byte blocks of records to spread the writes over
+      //#define POWER_LOSS_JOURNAL_MOVES 50 // Also save after this many extruding moves
+    #endif
+
     // Enable if Z homing is needed for proper recovery. 99.9% of the time this should be disabled!
     //#define POWER_LOSS_RECOVER_ZHOME
     #if ENABLED(POWER_LOSS_RECOVER_ZHOME)
@@ -1524,6 +1696,12 @@
     #define SDSORT_DYNAMIC_RAM false  // Use dynamic allocation (within SD menus). Least expensive option. Set SDSORT_LIMIT before use!
     #define SDSORT_CACHE_VFATS 2      // Maximum number of 13-byte VFAT entries to use for sorting.
                                       // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
+    //#define SDSORT_INDEX              // Keep a sorted index of each folder in a file on the card, rebuilt when the folder changes.
+                                      // Folders of any size are sorted once and listed without reading the folder. Not with SDSORT_USES_RAM.
+                                      // M20 lists the root folder in this order. The index isn't rewritten during a print.
+    #if ENABLED(SDSORT_INDEX)
+      #define SDSORT_INDEX_FILE "SORTINDX.DAT"
+    #endif
   #endif
 
   // Allow international symbols in long filenames. To display correctly, the
@@ -2188,6 +2366,11 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  //#define STEPPER_PAGES 16
+  //#define STEPPER_PAGE_FORMAT SP_4x2_256  // SP_4x2_256, SP_4x1_512, SP_4x4D_128, or SP_4x4DR_128 (with a step rate per segment)
+  //#define DIRECT_STEPPING_CRC16           // Check pages and page state reports with CRC16 instead of an 8-bit XOR
+#endif
 
 /**
  * G38 Probe Target
@@ -2284,6 +2467,11 @@
 // :[0, 2, 4, 8, 16, 32, 64, 128, 256]
 #define TX_BUFFER_SIZE 0
 
+// Count bytes dropped and the time spent waiting for room in the
+// transmit buffer. Report with D7 (requires MARLIN_DEV_MODE).
+// Currently only for LINUX.
+//#define SERIAL_STATS_TX
+
 // Host Receive Buffer Size
 // Without XON/XOFF flow control (see SERIAL_XON_XOFF below) 32 bytes should be enough.
 // To use flow control, set this buffer size to at least 1024 bytes.
@@ -2312,6 +2500,12 @@
 // Not supported on all platforms.
 //#define RX_BUFFER_MONITOR
 
+// Parse complete lines directly from the serial receive buffer,
+// copying each one only once, straight into the command queue.
+// Lines with comments or escapes use the regular parser.
+// Requires HAL support. Currently only for LINUX.
+//#define SERIAL_RX_ZERO_COPY
+
 /**
  * Emergency Command Parser
  *
@@ -3742,6 +3936,24 @@
   //#define AUTO_REPORT_REDUNDANT // Include the "R" sensor in the auto-report
 #endif
 
+/**
+ * Temperature Telemetry
+ * Keep the latest samples of raw ADC, temperature, target, and heater PWM for
+ * every heater in a RAM ring, recorded each time new readings are ready.
+ * M156 sends the ring as a binary frame. Decode it with
+ * buildroot/share/scripts/temp_telemetry.py.
+ *
+ *  M156     : Send the ring over serial
+ *  M156 F   : Write the ring to TELEMTRY.BIN on the SD card
+ *  M156 C   : Clear the ring
+ *  M156 S<0|1> : Pause / resume recording
+ */
+//#define TEMP_TELEMETRY
+#if ENABLED(TEMP_TELEMETRY)
+  #define TEMP_TELEMETRY_SAMPLES 64   // (2..255) Samples kept. Each takes 2 + 7 bytes per heater.
+  //#define TEMP_TELEMETRY_DUMP_ON_ERROR  // Send the ring over serial when a heater error stops the machine
+#endif
+
 /**
  * Auto-report position with M154 S<seconds>
  */
@@ -3787,6 +3999,23 @@
      * A non-zero value activates Volume-based Extrusion Limiting.
      */
     #define DEFAULT_VOLUMETRIC_EXTRUDER_LIMIT 0.00      // (mm^3/sec)
+
+    /**
+     * Dynamic Volumetric Limit
+     * Lower a hotend's volumetric limit when it can't keep up with the flow, as shown
+     * by its temperature falling behind the target or its heater running flat out.
+     * New moves are planned slower until the hotend catches up, then the limit is
+     * raised again gradually. This slows printing instead of under-extruding.
+     */
+    //#define VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC
+    #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC)
+      #define DYNAMIC_LIMIT_MAX_DEFICIT   4     // (°C) Drop below target that shows the hotend is falling behind
+      #define DYNAMIC_LIMIT_MAX_DUTY     95     // (%) Heater duty that counts as flat out while below target
+      #define DYNAMIC_LIMIT_DECREASE     10     // (%) Flow taken away for each second over capacity
+      #define DYNAMIC_LIMIT_RECOVER       5     // (%) Flow given back for each second under capacity
+      #define DYNAMIC_LIMIT_MIN_FLOW      2.0   // (mm^3/sec) Never limit the flow below this
+      #define DYNAMIC_LIMIT_TARGET_GRACE 30     // (s) Time to reach a new target before a deficit counts
+    #endif
   #endif
 #endif
 
@@ -3819,6 +4048,18 @@
 //#define MEATPACK_ON_SERIAL_PORT_1
 //#define MEATPACK_ON_SERIAL_PORT_2
 
+/**
+ * MeatPack v2 Dictionary
+ * The host loads a small dictionary of frequent tokens (e.g., "G1 X", " E", " F")
+ * which are then sent as a single byte, 0x80 + index. Tokens are expanded before
+ * the command queue. The MeatPack report also includes the achieved expansion ratio.
+ */
+//#define MEATPACK_DICTIONARY
+#if ENABLED(MEATPACK_DICTIONARY)
+  #define MEATPACK_DICT_SIZE      16  // Number of tokens (1-64)
+  #define MEATPACK_DICT_TOKEN_LEN  6  // Maximum length of a token (1-16)
+#endif
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -3845,6 +4086,18 @@
  */
 //#define STARTUP_COMMANDS "M17 Z"
 
+/**
+ * Fast Boot
+ *
+ * Bring up the host connection and heater safety first. The UBL mesh and
+ * the Trinamic driver connection test are left for idle() after setup(),
+ * and media present at startup is mounted without the settling delay.
+ */
+//#define FAST_BOOT
+
+// Report the time taken by each stage of startup
+//#define BOOT_TIMINGS
+
 /**
  * G-code Macros
  *
@@ -99,3 +99,12 @@
 #if USING_PULLDOWNS
   #error "PULLDOWN pin mode is not available on AVR boards."
 #endif
+
+/**
+ * Hardware PWM Heaters
+ * The AVR HAL PWM only sets 8-bit timers or the 16-bit timers left free by the
+ * steppers, serial, and tone, so it can't be relied on for heater pins.
+ */
+#if ENABLED(HEATER_HARDWARE_PWM)
+  #error "HEATER_HARDWARE_PWM is not supported on AVR boards."
+#endif
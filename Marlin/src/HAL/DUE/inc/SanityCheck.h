@@ -76,8 +76,8 @@
   #endif
 #endif
 
-#if ENABLED(FAST_PWM_FAN) || SPINDLE_LASER_FREQUENCY
-  #error "Features requiring Hardware PWM (FAST_PWM_FAN, SPINDLE_LASER_FREQUENCY) are not yet supported on DUE."
+#if EITHER(FAST_PWM_FAN, HEATER_HARDWARE_PWM) || SPINDLE_LASER_FREQUENCY
+  #error "Features requiring Hardware PWM (FAST_PWM_FAN, HEATER_HARDWARE_PWM, SPINDLE_LASER_FREQUENCY) are not yet supported on DUE."
 #endif
 
 #if HAS_TMC_SW_SERIAL
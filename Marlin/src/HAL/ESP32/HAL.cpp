@@ -373,6 +373,11 @@ int8_t MarlinHAL::set_pwm_frequency(const pin_t pin, const uint32_t f_desired) {
     }
 }
 
+bool MarlinHAL::attach_pwm(const pin_t pin) {
+  if (TERN0(I2S_STEPPER_STREAM, pin > 127)) return true;
+  return get_pwm_channel(pin, PWM_FREQUENCY, PWM_RESOLUTION) >= 0;
+}
+
 // use hardware PWM if avail, if not then ISR
 void analogWrite(const pin_t pin, const uint16_t value, const uint32_t freq/*=PWM_FREQUENCY*/, const uint16_t res/*=8*/) { // always 8 bit resolution!
   // Use ledc hardware for internal pins
@@ -243,4 +243,10 @@ public:
    */
   static int8_t set_pwm_frequency(const pin_t pin, const uint32_t f_desired);
 
+  /**
+   * If not already allocated, allocate a hardware PWM channel to the pin.
+   * Returns false if no channel is available.
+   */
+  static bool attach_pwm(const pin_t pin);
+
 };
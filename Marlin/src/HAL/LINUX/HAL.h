@@ -82,6 +82,7 @@ extern MSerialT usb_serial;
 // ADC
 #define HAL_ADC_VREF           5.0
 #define HAL_ADC_RESOLUTION    10
+#define HAL_ADC_DMA_SCAN              // Simulated reads are always current
 
 // ------------------------
 // Class Utilities
@@ -155,11 +156,15 @@ public:
 
   /**
    * Set the PWM duty cycle for the pin to the given value.
-   * No option to change the resolution or invert the duty cycle.
+   * The simulated pin holds an 8-bit duty, so other sizes are scaled down.
    */
-  static void set_pwm_duty(const pin_t pin, const uint16_t v, const uint16_t=255, const bool=false) {
-    analogWrite(pin, v);
+  static void set_pwm_duty(const pin_t pin, const uint16_t v, const uint16_t v_size=255, const bool invert=false) {
+    const uint16_t duty = invert ? v_size - v : v;
+    analogWrite(pin, v_size == 255 ? duty : uint32_t(duty) * 255 / v_size);
   }
 
   static void set_pwm_frequency(const pin_t, int) {}
+
+  // Every simulated pin can hold a duty
+  static bool attach_pwm(const pin_t) { return true; }
 };
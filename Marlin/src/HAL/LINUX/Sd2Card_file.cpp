@@ -0,0 +1,117 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if NEED_SD2CARD_FILE
+
+#include "Sd2Card_file.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#if ENABLED(SD_READ_AHEAD)
+
+  #include <atomic>
+  #include <condition_variable>
+  #include <mutex>
+  #include <thread>
+
+  // A single background read, handed to the worker thread
+  static std::mutex read_mutex;
+  static std::condition_variable read_request;
+  static int read_fd;
+  static uint32_t read_block;
+  static uint8_t *read_dst;
+  static std::atomic<int8_t> read_state(DISKIO_IDLE);
+
+  static void read_worker() {
+    for (;;) {
+      std::unique_lock<std::mutex> lock(read_mutex);
+      read_request.wait(lock, []{ return read_state == DISKIO_BUSY && read_dst; });
+      const ssize_t n = pread(read_fd, read_dst, 512, off_t(read_block) << 9);
+      read_dst = nullptr;
+      read_state = n == 512 ? DISKIO_DONE : DISKIO_ERROR;
+    }
+  }
+
+  bool DiskIODriver_File::readBlockAsync(const uint32_t block, uint8_t *dst, diskio_callback_t callback/*=nullptr*/) {
+    waitRead();
+    if (fd < 0) return false;
+
+    static std::thread *worker = nullptr;
+    if (!worker) worker = new std::thread(read_worker);
+
+    {
+      std::lock_guard<std::mutex> lock(read_mutex);
+      read_fd = fd;
+      read_block = block;
+      read_dst = dst;
+      read_state = DISKIO_BUSY;
+    }
+    async_callback = callback;
+    async_status = DISKIO_BUSY;
+    read_request.notify_one();
+    return true;
+  }
+
+  DiskIOStatus DiskIODriver_File::pollRead() {
+    if (async_status == DISKIO_BUSY && read_state != DISKIO_BUSY)
+      async_status = DiskIOStatus(int8_t(read_state));
+    return finishRead(async_status);
+  }
+
+  void DiskIODriver_File::waitRead() {
+    while (async_status == DISKIO_BUSY && read_state == DISKIO_BUSY) std::this_thread::yield();
+  }
+
+#else
+
+  void DiskIODriver_File::waitRead() {}
+
+#endif // SD_READ_AHEAD
+
+bool DiskIODriver_File::init(const uint8_t, const pin_t) {
+  waitRead();
+  if (fd < 0) fd = open(SD_IMAGE_FILE, O_RDWR);
+  return fd >= 0;
+}
+
+bool DiskIODriver_File::readBlock(uint32_t block, uint8_t *dst) {
+  waitRead();
+  return fd >= 0 && pread(fd, dst, 512, off_t(block) << 9) == 512;
+}
+
+bool DiskIODriver_File::writeBlock(uint32_t block, const uint8_t *src) {
+  waitRead();
+  return fd >= 0 && pwrite(fd, src, 512, off_t(block) << 9) == 512;
+}
+
+uint32_t DiskIODriver_File::cardSize() {
+  struct stat st;
+  return (fd >= 0 && fstat(fd, &st) == 0) ? uint32_t(st.st_size >> 9) : 0;
+}
+
+#endif // NEED_SD2CARD_FILE
+#endif // __PLAT_LINUX__
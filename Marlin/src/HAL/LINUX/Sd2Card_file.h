@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * SD card emulation with a disk image file, for testing SDSUPPORT.
+ * Create a FAT image (e.g., "mkfs.vfat -C sdcard.img 65536") and copy G-code files into it.
+ */
+
+#include "../../inc/MarlinConfig.h"
+#include "../../sd/SdInfo.h"
+#include "../../sd/disk_io_driver.h"
+
+#ifndef SD_IMAGE_FILE
+  #define SD_IMAGE_FILE "sdcard.img"
+#endif
+
+class DiskIODriver_File : public DiskIODriver {
+  public:
+    bool init(const uint8_t sckRateID=0, const pin_t chipSelectPin=0) override;
+
+    bool readCSD(csd_t *csd)                              override { return false; }
+
+    bool readStart(const uint32_t block)                  override { curBlock = block; return true; }
+    bool readData(uint8_t *dst)                           override { return readBlock(curBlock++, dst); }
+    bool readStop()                                       override { curBlock = -1; return true; }
+
+    bool writeStart(const uint32_t block, const uint32_t) override { curBlock = block; return true; }
+    bool writeData(const uint8_t *src)                    override { return writeBlock(curBlock++, src); }
+    bool writeStop()                                      override { curBlock = -1; return true; }
+
+    bool readBlock(uint32_t block, uint8_t *dst) override;
+    bool writeBlock(uint32_t block, const uint8_t *src) override;
+
+    uint32_t cardSize() override;
+
+    bool isReady()                                        override { return fd >= 0; }
+
+    void idle()                                           override {}
+
+    #if ENABLED(SD_READ_AHEAD)
+      // Reads are done in the background by a worker thread
+      bool asyncRead()                                    override { return true; }
+      bool readBlockAsync(const uint32_t block, uint8_t *dst, diskio_callback_t callback=nullptr) override;
+      DiskIOStatus pollRead() override;
+    #endif
+
+  private:
+    int fd = -1;
+    uint32_t curBlock;
+    void waitRead();
+};
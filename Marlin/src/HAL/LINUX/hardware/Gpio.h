@@ -64,6 +64,7 @@ struct pin_data {
   uint8_t dir;
   uint8_t mode;
   uint16_t value;
+  bool analog;    // The value is an 8-bit duty from analogWrite, not a digital level
   Peripheral* cb;
 };
 
@@ -81,10 +82,11 @@ public:
     set(pin, 1);
   }
 
-  static void set(pin_type pin, uint16_t value) {
+  static void set(pin_type pin, uint16_t value, const bool analog=false) {
     if (!valid_pin(pin)) return;
     GpioEvent::Type evt_type = value > 1 ? GpioEvent::SET_VALUE : value > pin_map[pin].value ? GpioEvent::RISE : value < pin_map[pin].value ? GpioEvent::FALL : GpioEvent::NOP;
     pin_map[pin].value = value;
+    pin_map[pin].analog = analog;
     GpioEvent evt(Clock::nanos(), pin, evt_type);
     if (pin_map[pin].cb) {
       pin_map[pin].cb->interrupt(evt);
@@ -97,6 +99,13 @@ public:
     return pin_map[pin].value;
   }
 
+  // The output level from 0 to 1, for a PWM duty or a digital level
+  static float duty(pin_type pin) {
+    if (!valid_pin(pin)) return 0;
+    const pin_data &p = pin_map[pin];
+    return p.analog ? p.value / 255.0f : (p.value ? 1.0f : 0.0f);
+  }
+
   static void clear(pin_type pin) {
     set(pin, 0);
   }
@@ -24,32 +24,78 @@
 #include "Clock.h"
 #include <stdio.h>
 #include "../../../inc/MarlinConfig.h"
+#include "../../../module/planner.h"
+#include "../../../module/temperature.h"
 
 #include "Heater.h"
 
-Heater::Heater(pin_t heater, pin_t adc) {
-  heater_state = 0;
-  room_temp_raw = 150;
-  last = Clock::micros();
-  heater_pin = heater;
-  adc_pin = adc;
-  heat = 0.0;
+Heater::Heater(pin_t heater, pin_t adc, const heater_model_t &model, to_celsius_t to_celsius, pin_t fan/*=P_NC*/, LinearAxis *extruder/*=nullptr*/)
+  : heater_pin(heater), adc_pin(adc), fan_pin(fan), model(model), to_celsius(to_celsius), extruder(extruder)
+{
+  extruder_position = extruder ? extruder->position : 0;
+  block_temp = sensor_temp = model.ambient_temp;
+  adc_error = 0;
+  last = Clock::nanos();
+  cut_temp = 0;
+  cut = false;
 }
 
 Heater::~Heater() {
 }
 
+// Advance the model by 'dt' seconds
+void Heater::step(const float dt, const float duty, const float fan, const float e_speed) {
+  const float delta_ambient = block_temp - model.ambient_temp,
+              ambient_xfer = model.ambient_xfer_coeff_fan0 + fan * model.fan255_adjustment,
+              watts = model.heater_power * duty
+                    - ambient_xfer * delta_ambient
+                    - e_speed * model.filament_heat_capacity_permm * delta_ambient;
+  block_temp += watts * dt / model.block_heat_capacity;
+  sensor_temp += (block_temp - sensor_temp) * _MIN(1.0f, model.sensor_responsiveness * dt);
+}
+
+// The 10-bit ADC reading (with fraction) that the firmware converts to 'temp'
+float Heater::temp_to_adc(const float temp) {
+  uint16_t lo = 0, hi = MAX_RAW_THERMISTOR_VALUE;
+  const bool rising = to_celsius(hi) > to_celsius(lo);
+  while (hi - lo > 1) {
+    const uint16_t mid = (lo + hi) / 2;
+    if ((to_celsius(mid) < temp) == rising) lo = mid; else hi = mid;
+  }
+  return float(lo) / (OVERSAMPLENR);
+}
+
 void Heater::update() {
-  // crude pwm read and cruder heat simulation
-  auto now = Clock::micros();
-  double delta = (now - last);
-  if (delta > 1000 ) {
-    heater_state = pwmcap.update(0xFFFF * Gpio::pin_map[heater_pin].value);
-    last = now;
-    heat += (heater_state - heat) * (delta / 1000000000.0);
-
-    NOLESS(heat, room_temp_raw);
-    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = 0xFFFF - (uint16_t)heat;
+  const uint64_t now = Clock::nanos();
+  float dt = (now - last) / 1000000000.0f;
+  if (dt < 0.001f) return;
+  last = now;
+
+  // Switched by the temperature ISR, or driven with analogWrite. A cut heater gets no power.
+  if (cut_temp > 0 && sensor_temp >= cut_temp) cut = true;
+  const float duty = cut ? 0 : Gpio::duty(heater_pin),
+              fan = Gpio::duty(fan_pin);
+
+  // Filament pushed into the hotend since the last update
+  float e_speed = 0;
+  #if HAS_EXTRUDERS
+    if (extruder) {
+      const int32_t pos = extruder->position;
+      if (pos > extruder_position) e_speed = (pos - extruder_position) / planner.settings.axis_steps_per_mm[E_AXIS] / dt;
+      extruder_position = pos;
+    }
+  #endif
+
+  // Short steps keep the model stable if the thread was held up
+  for (; dt > 0.05f; dt -= 0.05f) step(0.05f, duty, fan, e_speed);
+  step(dt, duty, fan, e_speed);
+
+  // Dither the reading so oversampling recovers the fraction
+  if (to_celsius) {
+    const float adc = temp_to_adc(sensor_temp) + adc_error;
+    const uint16_t reading = constrain(LROUND(adc), 0, HAL_ADC_RANGE - 1);
+    adc_error = adc - reading;
+    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = reading << 2;
   }
 }
 
@@ -22,26 +22,45 @@
 #pragma once
 
 #include "Gpio.h"
+#include "LinearAxis.h"
 
-struct LowpassFilter {
-  uint64_t data_delay = 0;
-  uint16_t update(uint16_t value) {
-    data_delay += value - (data_delay >> 6);
-    return uint16_t(data_delay >> 6);
-  }
-};
+/**
+ * Lumped thermal model of a heater, using the same parameters as MPC (M306).
+ * The heater warms a block, which loses heat to the air (more with the fan on)
+ * and to extruded filament. The sensor lags the block by sensor_responsiveness.
+ */
+typedef struct {
+  float heater_power,                 // (W) Heater power at full duty
+        block_heat_capacity,          // (J/K) Heat capacity of the block or plate
+        sensor_responsiveness,        // (K/s per ∆K) Rate of change of sensor temperature from the block
+        ambient_xfer_coeff_fan0,      // (W/K) Heat transfer to the air with the fan off
+        fan255_adjustment,            // (W/K) Additional heat transfer with the fan on full
+        filament_heat_capacity_permm, // (J/K/mm) Heat taken by each mm of filament
+        ambient_temp;                 // (°C) Room temperature
+} heater_model_t;
 
 class Heater: public Peripheral {
 public:
-  Heater(pin_t heater, pin_t adc);
+  typedef float (*to_celsius_t)(const uint16_t raw);
+
+  // 'to_celsius' converts an oversampled reading as the firmware does. The fan pin and extruder are optional.
+  Heater(pin_t heater, pin_t adc, const heater_model_t &model, to_celsius_t to_celsius, pin_t fan=P_NC, LinearAxis *extruder=nullptr);
   virtual ~Heater();
   void interrupt(GpioEvent ev);
   void update();
 
-  pin_t heater_pin, adc_pin;
-  uint16_t room_temp_raw;
-  uint16_t heater_state;
-  LowpassFilter pwmcap;
-  double heat;
+  pin_t heater_pin, adc_pin, fan_pin;
+  heater_model_t model;
+  to_celsius_t to_celsius;
+  LinearAxis *extruder;
+  int32_t extruder_position;
+  float block_temp, sensor_temp;
+  float adc_error;                    // Dither carried to the next reading
   uint64_t last;
+  float cut_temp;                     // (°C) Disconnect the heater once the sensor gets this hot, or 0 for never
+  bool cut;                           // The heater has been disconnected
+
+private:
+  void step(const float dt, const float duty, const float fan, const float e_speed);
+  float temp_to_adc(const float temp);
 };
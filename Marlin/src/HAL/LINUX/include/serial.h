@@ -62,6 +62,30 @@ public:
     return true;
   }
 
+  // Write as many elements as there is room for. Return the number written.
+  uint32_t write(const T *values, uint32_t count) volatile {
+    const uint32_t room = free();
+    if (count > room) count = room;
+    for (uint32_t i = 0; i < count; i++) buffer[mask(index_write + i)] = values[i];
+    index_write += count;
+    return count;
+  }
+
+  // Number of elements that can be read without wrapping around the end of the array
+  uint32_t contiguous() volatile {
+    const uint32_t a = available(), r = buffer_size - mask(index_read);
+    return a < r ? a : r;
+  }
+
+  // Oldest element in the buffer, followed by contiguous() - 1 more
+  const T* span() volatile { return const_cast<const T*>(&buffer[mask(index_read)]); }
+
+  // Discard elements that were consumed through span()
+  void skip(uint32_t count) volatile {
+    const uint32_t a = available();
+    index_read += count < a ? count : a;
+  }
+
 private:
   uint32_t mask(uint32_t val) volatile {
     return buffer_mask & val;
@@ -87,12 +111,28 @@ struct HalSerial {
 
   int read() { return receive_buffer.read(); }
 
+  #if ENABLED(SERIAL_RX_ZERO_COPY)
+    // Expose received data in place so whole lines can be parsed without a copy
+    size_t rxSpan(const uint8_t **ptr) { *ptr = receive_buffer.span(); return receive_buffer.contiguous(); }
+    void rxConsume(const size_t count) { receive_buffer.skip(count); }
+  #endif
+
   size_t write(char c) {
-    if (!host_connected) return 0;
-    while (!transmit_buffer.free());
+    if (!host_connected) { TERN_(SERIAL_STATS_TX, tx_dropped++); return 0; }
+    waitTX();
     return transmit_buffer.write(c);
   }
 
+  // Copy whole runs of bytes into the transmit buffer, waiting only when it is full
+  size_t writeBuffer(const uint8_t *buffer, size_t size) {
+    if (!host_connected) { TERN_(SERIAL_STATS_TX, tx_dropped += size); return 0; }
+    for (size_t i = 0; i < size;) {
+      waitTX();
+      i += transmit_buffer.write(buffer + i, size - i);
+    }
+    return size;
+  }
+
   bool connected() { return host_connected; }
 
   uint16_t available() {
@@ -110,9 +150,31 @@ struct HalSerial {
       while (transmit_buffer.available()) { /* nada */ }
   }
 
+  #if ENABLED(SERIAL_STATS_TX)
+    uint32_t txDropped() { return tx_dropped; }
+    uint32_t txBlocked() { return tx_blocked_ms; }
+  #endif
+
   volatile RingBuffer<uint8_t, 128> receive_buffer;
   volatile RingBuffer<uint8_t, 128> transmit_buffer;
   volatile bool host_connected;
+
+private:
+  #if ENABLED(SERIAL_STATS_TX)
+    uint32_t tx_dropped = 0, tx_blocked_ms = 0;
+  #endif
+
+  // Wait for the output thread to make room in the transmit buffer
+  void waitTX() {
+    if (!transmit_buffer.full()) return;
+    #if ENABLED(SERIAL_STATS_TX)
+      const uint32_t ms = millis();
+      while (transmit_buffer.full()) { /* nada */ }
+      tx_blocked_ms += millis() - ms;
+    #else
+      while (transmit_buffer.full()) { /* nada */ }
+    #endif
+  }
 };
 
 typedef Serial1Class<HalSerial> MSerialT;
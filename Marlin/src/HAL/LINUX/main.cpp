@@ -26,11 +26,13 @@
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
+#include "../../module/temperature.h"
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdarg.h>
 #include <thread>
 #include <iostream>
@@ -39,12 +41,33 @@
 extern void setup();
 extern void loop();
 
+// Simulated heaters, as { heater_power, block_heat_capacity, sensor_responsiveness,
+// ambient_xfer_coeff_fan0, fan255_adjustment, filament_heat_capacity_permm, ambient_temp }
+#ifndef SIM_HOTEND_MODEL
+  #define SIM_HOTEND_MODEL { 40.0f, 16.7f, 0.22f, 0.068f, 0.029f, 5.6e-3f, 25.0f }
+#endif
+#ifndef SIM_BED_MODEL
+  #define SIM_BED_MODEL { 250.0f, 600.0f, 0.05f, 1.5f, 0.0f, 0.0f, 25.0f }
+#endif
+
+// Speed of simulated time. Override at run time with MARLIN_SIM_SPEED, e.g., 40 for CI.
+// Timer ISRs are POSIX signals scaled by the same factor, so higher speeds starve the
+// main loop and can hang it at startup. The speed is limited to SIM_TIME_MULTIPLIER_MAX.
+#ifndef SIM_TIME_MULTIPLIER
+  #define SIM_TIME_MULTIPLIER 1.0
+#endif
+#ifndef SIM_TIME_MULTIPLIER_MAX
+  #define SIM_TIME_MULTIPLIER_MAX 40.0
+#endif
+
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
   for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
+    const std::size_t count = usb_serial.transmit_buffer.available();
+    for (std::size_t i = count; i > 0; i--) {
       fputc(usb_serial.transmit_buffer.read(), stdout);
     }
+    if (count) fflush(stdout); // Don't hold output back when stdout is a pipe or file
     std::this_thread::yield();
   }
 }
@@ -61,13 +84,28 @@ void read_serial_thread() {
 }
 
 void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
   LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
   LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
 
+  // Readings are made to convert back to the modeled temperature
+  Heater hotend(HEATER_0_PIN, TEMP_0_PIN, SIM_HOTEND_MODEL,
+    TERN(HAS_TEMP_HOTEND, [](const uint16_t raw) { return thermalManager.analog_to_celsius_hotend(raw, 0); }, nullptr),
+    TERN(HAS_FAN0, FAN_PIN, P_NC), &extruder0
+  );
+  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN, SIM_BED_MODEL,
+    TERN(HAS_TEMP_BED, [](const uint16_t raw) { return thermalManager.analog_to_celsius_bed(raw); }, nullptr)
+  );
+
+  // Disconnect a heater once it reaches the given temperature, e.g., to test thermal runaway protection
+  auto cut_heater = [](Heater &heater, const char * const env) {
+    const char * const temp = getenv(env);
+    if (temp) heater.cut_temp = atof(temp);
+  };
+  cut_heater(hotend, "MARLIN_SIM_HOTEND_CUT");
+  cut_heater(bed, "MARLIN_SIM_BED_CUT");
+
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
     Gpio::attachLogger(&logger);
@@ -116,7 +154,14 @@ int main() {
   #endif
 
   Clock::setFrequency(F_CPU);
-  Clock::setTimeMultiplier(1.0); // some testing at 10x
+  const char * const sim_speed = getenv("MARLIN_SIM_SPEED");
+  double time_multiplier = sim_speed ? atof(sim_speed) : SIM_TIME_MULTIPLIER;
+  if (!(time_multiplier > 0)) time_multiplier = 1.0;
+  if (time_multiplier > SIM_TIME_MULTIPLIER_MAX) {
+    fprintf(stderr, "Simulation speed limited to %gx\n", SIM_TIME_MULTIPLIER_MAX);
+    time_multiplier = SIM_TIME_MULTIPLIER_MAX;
+  }
+  Clock::setTimeMultiplier(time_multiplier);
 
   HAL_timer_init();
 
@@ -264,4 +264,10 @@ public:
    * All Software PWM pins will run at the same frequency
    */
   static void set_pwm_frequency(const pin_t pin, const uint16_t f_desired);
+
+  /**
+   * Attach the pin to a hardware or software PWM channel.
+   * Returns false if no channel is available.
+   */
+  static bool attach_pwm(const pin_t pin);
 };
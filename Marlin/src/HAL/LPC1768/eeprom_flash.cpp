@@ -112,8 +112,11 @@ bool PersistentStore::access_finish() {
 }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  for (size_t i = 0; i < size; i++) ram_eeprom[pos + i] = value[i];
-  eeprom_dirty = true;
+  for (size_t i = 0; i < size; i++) {
+    if (ram_eeprom[pos + i] == value[i]) continue; // Only changes make the page dirty
+    ram_eeprom[pos + i] = value[i];
+    eeprom_dirty = true;
+  }
   crc16(crc, value, size);
   pos += size;
   return false;  // return true for any error
@@ -34,4 +34,8 @@ void MarlinHAL::set_pwm_frequency(const pin_t pin, const uint16_t f_desired) {
   LPC176x::pwm_set_frequency(pin, f_desired);
 }
 
+bool MarlinHAL::attach_pwm(const pin_t pin) {
+  return LPC176x::pin_is_valid(pin) && LPC176x::pwm_attach_pin(pin);
+}
+
 #endif // TARGET_LPC1768
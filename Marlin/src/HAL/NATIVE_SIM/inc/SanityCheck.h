@@ -30,8 +30,8 @@
   #error "SPINDLE_LASER_PWM_PIN must use SERVO0, SERVO1 or SERVO3 connector"
 #endif
 
-#if ENABLED(FAST_PWM_FAN) || SPINDLE_LASER_FREQUENCY
-  #error "Features requiring Hardware PWM (FAST_PWM_FAN, SPINDLE_LASER_FREQUENCY) are not yet supported on LINUX."
+#if EITHER(FAST_PWM_FAN, HEATER_HARDWARE_PWM) || SPINDLE_LASER_FREQUENCY
+  #error "Features requiring Hardware PWM (FAST_PWM_FAN, HEATER_HARDWARE_PWM, SPINDLE_LASER_FREQUENCY) are not yet supported on LINUX."
 #endif
 
 #if HAS_TMC_SW_SERIAL
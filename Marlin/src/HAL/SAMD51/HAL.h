@@ -109,6 +109,7 @@ typedef Servo hal_servo_t;
 //#define HAL_ADC_FILTERED          // Disable Marlin's oversampling. The HAL filters ADC values.
 #define HAL_ADC_VREF         3.3
 #define HAL_ADC_RESOLUTION  10      // ... 12
+#define HAL_ADC_DMA_SCAN            // All ADC channels are sampled continuously by DMA
 
 //
 // Pin Mapping for M42, M43, M226
@@ -48,8 +48,8 @@
   #error "SDIO_SUPPORT is not supported on SAMD51."
 #endif
 
-#if ENABLED(FAST_PWM_FAN) || SPINDLE_LASER_FREQUENCY
-  #error "Features requiring Hardware PWM (FAST_PWM_FAN, SPINDLE_LASER_FREQUENCY) are not yet supported on SAMD51."
+#if EITHER(FAST_PWM_FAN, HEATER_HARDWARE_PWM) || SPINDLE_LASER_FREQUENCY
+  #error "Features requiring Hardware PWM (FAST_PWM_FAN, HEATER_HARDWARE_PWM, SPINDLE_LASER_FREQUENCY) are not yet supported on SAMD51."
 #endif
 
 #if ENABLED(POSTMORTEM_DEBUGGING)
@@ -278,4 +278,10 @@ public:
    */
   static void set_pwm_frequency(const pin_t pin, const uint16_t f_desired);
 
+  /**
+   * Check that the pin has a hardware timer channel.
+   * Without one set_pwm_duty can only switch the pin on and off.
+   */
+  static bool attach_pwm(const pin_t pin) { return PWM_PIN(pin); }
+
 };
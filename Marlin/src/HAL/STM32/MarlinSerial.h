@@ -41,6 +41,11 @@ struct MarlinSerial : public HardwareSerial {
 
   void _rx_complete_irq(serial_t *obj);
 
+  #if STM32_CORE_VERSION >= 0x02000000
+    // Copy whole buffers into the TX ring, sent by the transmit interrupt
+    size_t writeBuffer(const uint8_t *buffer, size_t size) { return HardwareSerial::write(buffer, size); }
+  #endif
+
 protected:
   usart_rx_callback_t _rx_callback;
 };
@@ -49,9 +49,12 @@ void MarlinHAL::set_pwm_duty(const pin_t pin, const uint16_t v, const uint16_t v
     if (needs_freq && timer_freq[index] == 0)     // If the timer is unconfigured and no freq is set then default PWM_FREQUENCY
       set_pwm_frequency(pin_name, PWM_FREQUENCY); // Set the frequency and save the value to the assigned index no.
 
-    // Note the resolution is sticky here, the input can be upto 16 bits and that would require RESOLUTION_16B_COMPARE_FORMAT (16)
-    // If such a need were to manifest then we would need to calc the resolution based on the v_size parameter and add code for it.
-    HT->setCaptureCompare(channel, duty, RESOLUTION_8B_COMPARE_FORMAT); // Set the duty, the calc is done in the library :)
+    // Set the duty, the calc is done in the library :)
+    // 8-bit input is passed as-is. Other sizes (e.g., HEATER_PWM_RESOLUTION) are scaled to 16 bits.
+    if (v_size == 255)
+      HT->setCaptureCompare(channel, duty, RESOLUTION_8B_COMPARE_FORMAT);
+    else
+      HT->setCaptureCompare(channel, uint32_t(duty) * 0xFFFFUL / v_size, RESOLUTION_16B_COMPARE_FORMAT);
     pinmap_pinout(pin_name, PinMap_PWM); // Make sure the pin output state is set.
     if (previousMode != TIMER_OUTPUT_COMPARE_PWM1) HT->resume();
   }
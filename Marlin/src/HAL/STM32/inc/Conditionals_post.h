@@ -27,3 +27,8 @@
 #elif EITHER(I2C_EEPROM, SPI_EEPROM)
   #define USE_SHARED_EEPROM 1
 #endif
+
+// Read-ahead uses DMA to read SDIO blocks in the background
+#if BOTH(SDIO_SUPPORT, SD_READ_AHEAD)
+  #define HAS_SDIO_ASYNC_READ 1
+#endif
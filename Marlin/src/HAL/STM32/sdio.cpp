@@ -439,6 +439,73 @@ bool SDIO_WriteBlock(uint32_t block, const uint8_t *src) {
   #endif
 }
 
+#if HAS_SDIO_ASYNC_READ
+
+  static millis_t async_timeout;
+  #ifndef SDIO_FOR_STM32H7
+    static bool async_dma;
+  #endif
+
+  /**
+   * @brief Start reading a block
+   * @details Start a DMA read of a block and return without waiting
+   *
+   * @param block The block index
+   * @param dst The block buffer, untouchable until the read is done
+   *
+   * @return true if the read was started
+   */
+  bool SDIO_ReadBlockAsync(uint32_t block, uint8_t *dst) {
+    if (HAL_SD_GetCardState(&hsd) != HAL_SD_CARD_TRANSFER) return false;
+
+    #ifdef SDIO_FOR_STM32H7
+      waitingRxCplt = 1;
+      if (HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, 1) != HAL_OK) return false;
+    #else
+      hdma_sdio.Init.Direction = DMA_PERIPH_TO_MEMORY;
+      HAL_DMA_Init(&hdma_sdio);
+      if (HAL_SD_ReadBlocks_DMA(&hsd, (uint8_t*)dst, block, 1) != HAL_OK) {
+        HAL_DMA_Abort_IT(&hdma_sdio);
+        HAL_DMA_DeInit(&hdma_sdio);
+        return false;
+      }
+      async_dma = true;
+    #endif
+
+    async_timeout = millis() + SD_TIMEOUT;
+    return true;
+  }
+
+  /**
+   * @brief Check an asynchronous read
+   *
+   * @return 1 when the read is done, 0 while busy, -1 on error
+   */
+  int8_t SDIO_ReadBlockPoll() {
+    const bool expired = ELAPSED(millis(), async_timeout);
+
+    #ifdef SDIO_FOR_STM32H7
+      if (waitingRxCplt) return expired ? -1 : 0;
+    #else
+      if (async_dma) {
+        if (hsd.State != HAL_SD_STATE_READY && !expired) return 0;
+        const bool ok = hsd.State == HAL_SD_STATE_READY;
+        if (ok)
+          while (__HAL_DMA_GET_FLAG(&hdma_sdio, __HAL_DMA_GET_TC_FLAG_INDEX(&hdma_sdio)) != 0
+              || __HAL_DMA_GET_FLAG(&hdma_sdio, __HAL_DMA_GET_TE_FLAG_INDEX(&hdma_sdio)) != 0) { /* nada */ }
+        HAL_DMA_Abort_IT(&hdma_sdio);
+        HAL_DMA_DeInit(&hdma_sdio);
+        async_dma = false;
+        if (!ok) return -1;
+      }
+    #endif
+
+    if (HAL_SD_GetCardState(&hsd) != HAL_SD_CARD_TRANSFER) return expired ? -1 : 0;
+    return 1;
+  }
+
+#endif // HAS_SDIO_ASYNC_READ
+
 bool SDIO_IsReady() {
   return hsd.State == HAL_SD_STATE_READY;
 }
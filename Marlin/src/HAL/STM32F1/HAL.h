@@ -191,6 +191,7 @@ typedef int8_t pin_t;
 #endif
 
 #define HAL_ADC_VREF         3.3
+#define HAL_ADC_DMA_SCAN            // All ADC channels are sampled continuously by DMA
 
 uint16_t analogRead(const pin_t pin); // need hal.adc_enable() first
 void analogWrite(const pin_t pin, int pwm_val8); // PWM only! mul by 257 in maple!?
@@ -306,4 +307,10 @@ public:
    */
   static void set_pwm_frequency(const pin_t pin, const uint16_t f_desired);
 
+  /**
+   * Check that the pin has a hardware timer channel.
+   * Without one set_pwm_duty can only switch the pin on and off.
+   */
+  static bool attach_pwm(const pin_t pin) { return PWM_PIN(pin); }
+
 };
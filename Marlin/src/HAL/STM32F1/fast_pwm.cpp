@@ -36,6 +36,18 @@ inline uint8_t timer_and_index_for_pin(const pin_t pin, timer_dev **timer_ptr) {
   return 0;
 }
 
+#if ENABLED(HEATER_HARDWARE_PWM)
+  // Heater pins get the full HEATER_PWM_RESOLUTION instead of 8 bits
+  static bool is_heater_pin(const pin_t pin) {
+    #define _IS_HEATER_PIN(N) if (pin == pin_t(HEATER_##N##_PIN)) return true;
+    REPEAT(HOTENDS, _IS_HEATER_PIN)
+    TERN_(HEATERS_PARALLEL, _IS_HEATER_PIN(1))
+    TERN_(HAS_HEATED_BED, _IS_HEATER_PIN(BED))
+    TERN_(HAS_HEATED_CHAMBER, _IS_HEATER_PIN(CHAMBER))
+    return false;
+  }
+#endif
+
 void MarlinHAL::set_pwm_duty(const pin_t pin, const uint16_t v, const uint16_t v_size/*=255*/, const bool invert/*=false*/) {
   const uint16_t duty = invert ? v_size - v : v;
   if (PWM_PIN(pin)) {
@@ -43,7 +55,8 @@ void MarlinHAL::set_pwm_duty(const pin_t pin, const uint16_t v, const uint16_t v
     if (timer_freq[timer_and_index_for_pin(pin, &timer)] == 0)
       set_pwm_frequency(pin, PWM_FREQUENCY);
     const uint8_t channel = PIN_MAP[pin].timer_channel;
-    timer_set_compare(timer, channel, duty);
+    // Scale to the timer period, which a heater pin on the same timer may have changed
+    timer_set_compare(timer, channel, uint16_t(uint32_t(duty) * (timer_get_reload(timer) + 1) / v_size));
     timer_set_mode(timer, channel, TIMER_PWM); // PWM Output Mode
   }
   else {
@@ -72,6 +85,10 @@ void MarlinHAL::set_pwm_frequency(const pin_t pin, const uint16_t f_desired) {
   timer_set_mode(timer, channel, TIMER_PWM);
   // Preload (resolution) cannot be equal to duty of 255 otherwise it may not result in digital off or on.
   uint16_t preload = 254;
+  #if ENABLED(HEATER_HARDWARE_PWM)
+    // Same for the heater duty range. (e.g., 10 bits at 50Hz and 72MHz: preload 1022, prescaler 1406)
+    if (is_heater_pin(pin)) preload = uint16_t(_BV32(HEATER_PWM_RESOLUTION) - 2);
+  #endif
   int32_t prescaler = (HAL_TIMER_RATE) / (preload + 1) / f_desired - 1;
   if (prescaler > 65535) {                      // For low frequencies increase prescaler
     prescaler = 65535;
@@ -29,8 +29,8 @@
   #error "EMERGENCY_PARSER is not yet implemented for Teensy 3.1/3.2. Disable EMERGENCY_PARSER to continue."
 #endif
 
-#if ENABLED(FAST_PWM_FAN) || SPINDLE_LASER_FREQUENCY
-  #error "Features requiring Hardware PWM (FAST_PWM_FAN, SPINDLE_LASER_FREQUENCY) are not yet supported on Teensy 3.1/3.2."
+#if EITHER(FAST_PWM_FAN, HEATER_HARDWARE_PWM) || SPINDLE_LASER_FREQUENCY
+  #error "Features requiring Hardware PWM (FAST_PWM_FAN, HEATER_HARDWARE_PWM, SPINDLE_LASER_FREQUENCY) are not yet supported on Teensy 3.1/3.2."
 #endif
 
 #if HAS_TMC_SW_SERIAL
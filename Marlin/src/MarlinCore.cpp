@@ -761,6 +761,54 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
   #endif
 }
 
+#if ENABLED(BOOT_TIMINGS)
+
+  // Report a startup stage that took measurable time
+  static void report_boot_stage(PGM_P const name, const millis_t start_ms) {
+    const millis_t ms = millis() - start_ms;
+    if (!ms) return;
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPGM("Boot ", ms, "ms ");
+    SERIAL_ECHOLNPGM_P(name);
+  }
+  #define BOOT_RUN(C) do{ const millis_t stage_ms = millis(); C; report_boot_stage(PSTR(STRINGIFY(C)), stage_ms); }while(0)
+
+#else
+
+  #define BOOT_RUN(C) C
+
+#endif
+
+#if ENABLED(FAST_BOOT)
+
+  /**
+   * Finish the startup work left by setup(), one step per idle()
+   * so the host is served in between. The first step runs before
+   * the first command, so the mesh is ready for any move.
+   */
+  static bool boot_pending = true;
+
+  static void finish_boot() {
+    static uint8_t boot_step = 0;
+    switch (boot_step++) {
+      case 0:
+        #if BOTH(AUTO_BED_LEVELING_UBL, EEPROM_SETTINGS)
+          BOOT_RUN(settings.load_pending_mesh());
+        #endif
+        break;
+      case 1:
+        #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF)
+          BOOT_RUN(test_tmc_connection());
+        #endif
+        break;
+      default:
+        boot_pending = false;
+        TERN_(BOOT_TIMINGS, SERIAL_ECHO_MSG("Boot completed in ", millis(), "ms"));
+    }
+  }
+
+#endif
+
 /**
  * Standard idle routine keeps the machine alive:
  *  - Core Marlin activities
@@ -768,6 +816,7 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
  *  - Max7219 heartbeat, animation, etc.
  *
  *  Only after setup() is complete:
+ *  - Finish deferred startup work (FAST_BOOT)
  *  - Handle filament runout sensors
  *  - Run HAL idle tasks
  *  - Handle Power-Loss Recovery
@@ -801,6 +850,9 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Return if setup() isn't completed
   if (marlin_state == MF_INITIALIZING) goto IDLE_DONE;
 
+  // Finish the startup work left by setup()
+  TERN_(FAST_BOOT, if (boot_pending) finish_boot());
+
   // TODO: Still causing errors
   (void)check_tool_sensor_stats(active_extruder, true);
 
@@ -830,6 +882,9 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Read ahead in the file being printed
+  TERN_(SD_READ_AHEAD, card.read_ahead());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
@@ -865,6 +920,7 @@ void idle(bool no_stepper_sleep/*=false*/) {
       TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
       TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
+      TERN_(SD_IO_STATS, SdStats::auto_reporter.tick());
       TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
       TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
     }
@@ -1116,7 +1172,7 @@ inline void tmc_standby_setup() {
  *    • Closed Loop Controller
  *  - Run Startup Commands, if defined
  *  - Tell host to close Host Prompts
- *  - Test Trinamic driver connections
+ *  - Test Trinamic driver connections (in idle() with FAST_BOOT)
  *  - Init Prusa MMU2 filament changer
  *  - Init and test BL24Cxx EEPROM
  *  - Init Creality DWIN encoder, show faux progress bar
@@ -1153,7 +1209,7 @@ void setup() {
   #else
     #define SETUP_LOG(...) NOOP
   #endif
-  #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); C; }while(0)
+  #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); BOOT_RUN(C); }while(0)
 
   MYSERIAL1.begin(BAUDRATE);
   millis_t serial_connect_timeout = millis() + 1000UL;
@@ -1634,13 +1690,14 @@ void setup() {
     SETUP_RUN(easythreed_ui.init());
   #endif
 
-  #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF)
+  #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF) && DISABLED(FAST_BOOT)
     SETUP_RUN(test_tmc_connection());
   #endif
 
   marlin_state = MF_RUNNING;
 
   SETUP_LOG("setup() completed.");
+  TERN_(BOOT_TIMINGS, SERIAL_ECHO_MSG("Boot setup() completed in ", millis(), "ms"));
 }
 
 /**
@@ -184,6 +184,7 @@
 #define STR_SD_NOT_PRINTING                 "Not SD printing"
 #define STR_SD_ERR_WRITE_TO_FILE            "error writing to file"
 #define STR_SD_ERR_READ                     "SD read error"
+#define STR_SD_FREED_UNFINISHED             "Freed the space of unfinished file "
 #define STR_SD_CANT_ENTER_SUBDIR            "Cannot enter subdir: "
 
 #define STR_ENDSTOPS_HIT                    "endstops hit: "
@@ -213,6 +214,7 @@
 #define STR_PID_BAD_HEATER_ID               " failed! Bad heater id"
 #define STR_PID_TEMP_TOO_HIGH               " failed! Temperature too high"
 #define STR_PID_TIMEOUT                     " failed! timeout"
+#define STR_PID_OVER_BUDGET                 " failed! Heater power over HEATER_POWER_LIMIT"
 #define STR_BIAS                            " bias: "
 #define STR_D_COLON                         " d: "
 #define STR_T_MIN                           " min: "
@@ -229,11 +231,11 @@
 #define STR_PID_DEBUG_OUTPUT                " Output "
 #define STR_INVALID_EXTRUDER_NUM            " - Invalid extruder number !"
 #define STR_MPC_AUTOTUNE                    "MPC Autotune"
-#define STR_MPC_AUTOTUNE_START              " start for " STR_E
+#define STR_MPC_AUTOTUNE_START              " start for "
 #define STR_MPC_AUTOTUNE_INTERRUPTED        " interrupted!"
 #define STR_MPC_AUTOTUNE_FINISHED           " finished! Put the constants below into Configuration.h"
 #define STR_MPC_COOLING_TO_AMBIENT          "Cooling to ambient"
-#define STR_MPC_HEATING_PAST_200            "Heating to over 200C"
+#define STR_MPC_HEATING_PAST                "Heating to over "
 #define STR_MPC_MEASURING_AMBIENT           "Measuring ambient heatloss at "
 #define STR_MPC_TEMPERATURE_ERROR           "Temperature error"
 
@@ -69,6 +69,21 @@ ENUM_FLAGS(SerialFeature);
 CALL_IF_EXISTS_IMPL(void, flushTX);
 CALL_IF_EXISTS_IMPL(bool, connected, true);
 CALL_IF_EXISTS_IMPL(SerialFeature, features, SerialFeature::None);
+// In-place access to received data is optional. Ports without it report an empty span.
+CALL_IF_EXISTS_IMPL(size_t, rxSpan, 0);
+CALL_IF_EXISTS_IMPL(void, rxConsume);
+// Bulk output is optional. Ports without it are written byte by byte.
+CALL_IF_EXISTS_IMPL(size_t, writeBuffer, 0);
+
+// Write a whole buffer with a single call if the port supports it
+template <class SerialT>
+FORCE_INLINE size_t serial_write_buffer(SerialT * const s, const uint8_t *buffer, size_t size) {
+  if (Private::HasMember_writeBuffer<SerialT>::value)
+    return CALL_IF_EXISTS(size_t, s, writeBuffer, buffer, size);
+  const size_t count = size;
+  while (size--) s->write(*buffer++);
+  return count;
+}
 
 // A simple forward struct to prevent the compiler from selecting print(double, int) as a default overload
 // for any type other than double/float. For double/float, a conversion exists so the call will be invisible.
@@ -136,8 +151,8 @@ struct SerialBase {
   void flushTX()                    { CALL_IF_EXISTS(void, SerialChild, flushTX); }
 
   // Glue code here
-  void write(const char *str)                    { while (*str) write(*str++); }
-  void write(const uint8_t *buffer, size_t size) { while (size--) write(*buffer++); }
+  void write(const char *str)                    { write((const uint8_t*)str, strlen(str)); }
+  void write(const uint8_t *buffer, size_t size) { serial_write_buffer(SerialChild, buffer, size); }
   void print(char *str)                          { write(str); }
   void print(const char *str)                    { write(str); }
   // No default argument to avoid ambiguity
@@ -184,7 +199,7 @@ struct SerialBase {
   void println(const char *s)         { print(s); println(); }
   void println(float c, int digits)   { print(c, digits); println(); }
   void println(double c, int digits)  { print(c, digits); println(); }
-  void println()                      { write('\r'); write('\n'); }
+  void println()                      { write((const uint8_t*)"\r\n", 2); }
 
   // Default implementations for types without a specialization. Handles integers.
   template <typename T>
@@ -200,13 +215,15 @@ struct SerialBase {
   // Print a number with the given base
   NO_INLINE void printNumber_unsigned(uint_fixed_print_t n, PrintBase base) {
     if (n) {
-      unsigned char buf[8 * sizeof(long)]; // Enough space for base 2
-      int8_t i = 0;
+      // Fill the buffer from the end so the digits go out in a single write
+      uint8_t buf[8 * sizeof(long)]; // Enough space for base 2
+      uint8_t i = sizeof(buf);
       while (n) {
-        buf[i++] = n % (uint_fixed_print_t)base;
+        const uint8_t d = n % (uint_fixed_print_t)base;
+        buf[--i] = d + (d < 10 ? '0' : 'A' - 10);
         n /= (uint_fixed_print_t)base;
       }
-      while (i--) write((char)(buf[i] + (buf[i] < 10 ? '0' : 'A' - 10)));
+      write(buf + i, sizeof(buf) - i);
     }
     else write('0');
   }
@@ -242,14 +259,17 @@ struct SerialBase {
 
     // Print the decimal point, but only if there are digits beyond
     if (digits) {
-      write('.');
+      uint8_t buf[16], i = 0;
+      buf[i++] = '.';
       // Extract digits from the remainder one at a time
       while (digits--) {
         remainder *= 10.0;
-        unsigned long toPrint = (unsigned long)remainder;
-        printNumber_unsigned(toPrint, PrintBase::Dec);
+        const uint8_t toPrint = (uint8_t)remainder;
+        buf[i++] = '0' + toPrint;
         remainder -= toPrint;
+        if (i == sizeof(buf)) { write(buf, i); i = 0; }
       }
+      if (i) write(buf, i);
     }
   }
 };
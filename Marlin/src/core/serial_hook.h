@@ -61,9 +61,14 @@ struct BaseSerial : public SerialBase< BaseSerial<SerialT> >, public SerialT {
 
   void msgDone() {}
 
+  // Hand whole buffers to the port when it can take them in bulk
+  size_t writeBuffer(const uint8_t *buffer, size_t size) { return serial_write_buffer(static_cast<SerialT*>(this), buffer, size); }
+
   // We don't care about indices here, since if one can call us, it's the right index anyway
   int available(serial_index_t) { return (int)SerialT::available(); }
   int read(serial_index_t)      { return (int)SerialT::read(); }
+  size_t rxSpan(serial_index_t, const uint8_t **ptr)  { return CALL_IF_EXISTS(size_t, static_cast<SerialT*>(this), rxSpan, ptr); }
+  void rxConsume(serial_index_t, const size_t count)  { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), rxConsume, count); }
   bool connected()              { return CALL_IF_EXISTS(bool, static_cast<SerialT*>(this), connected);; }
   void flushTX()                { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), flushTX); }
 
@@ -94,6 +99,7 @@ struct ConditionalSerial : public SerialBase< ConditionalSerial<SerialT> > {
   bool    & condition;
   SerialT & out;
   NO_INLINE size_t write(uint8_t c) { if (condition) return out.write(c); return 0; }
+  size_t writeBuffer(const uint8_t *buffer, size_t size) { return condition ? serial_write_buffer(&out, buffer, size) : 0; }
   void flush()                      { if (condition) out.flush();  }
   void begin(long br)               { out.begin(br); }
   void end()                        { out.end(); }
@@ -106,6 +112,8 @@ struct ConditionalSerial : public SerialBase< ConditionalSerial<SerialT> > {
   int read(serial_index_t)        { return (int)out.read(); }
   int available()                 { return (int)out.available(); }
   int read()                      { return (int)out.read(); }
+  size_t rxSpan(serial_index_t index, const uint8_t **ptr)  { return CALL_IF_EXISTS(size_t, &out, rxSpan, index, ptr); }
+  void rxConsume(serial_index_t index, const size_t count)  { CALL_IF_EXISTS(void, &out, rxConsume, index, count); }
   SerialFeature features(serial_index_t index) const  { return CALL_IF_EXISTS(SerialFeature, &out, features, index);  }
 
   ConditionalSerial(bool & conditionVariable, SerialT & out, const bool e) : BaseClassT(e), condition(conditionVariable), out(out) {}
@@ -118,6 +126,7 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
 
   SerialT & out;
   NO_INLINE size_t write(uint8_t c) { return out.write(c); }
+  size_t writeBuffer(const uint8_t *buffer, size_t size) { return serial_write_buffer(&out, buffer, size); }
   void flush()            { out.flush();  }
   void begin(long br)     { out.begin(br); }
   void end()              { out.end(); }
@@ -131,6 +140,8 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
   int read(serial_index_t)      { return (int)out.read(); }
   int available()               { return (int)out.available(); }
   int read()                    { return (int)out.read(); }
+  size_t rxSpan(serial_index_t, const uint8_t **ptr)  { return CALL_IF_EXISTS(size_t, &out, rxSpan, ptr); }
+  void rxConsume(serial_index_t, const size_t count)  { CALL_IF_EXISTS(void, &out, rxConsume, count); }
   SerialFeature features(serial_index_t index) const  { return CALL_IF_EXISTS(SerialFeature, &out, features, index);  }
 
   ForwardSerial(const bool e, SerialT & out) : BaseClassT(e), out(out) {}
@@ -152,12 +163,19 @@ struct RuntimeSerial : public SerialBase< RuntimeSerial<SerialT> >, public Seria
     return SerialT::write(c);
   }
 
+  NO_INLINE size_t writeBuffer(const uint8_t *buffer, size_t size) {
+    if (writeHook) for (size_t i = 0; i < size; i++) writeHook(userPointer, buffer[i]);
+    return serial_write_buffer(static_cast<SerialT*>(this), buffer, size);
+  }
+
   NO_INLINE void msgDone() {
     if (eofHook) eofHook(userPointer);
   }
 
   int available(serial_index_t)  { return (int)SerialT::available(); }
   int read(serial_index_t)       { return (int)SerialT::read(); }
+  size_t rxSpan(serial_index_t, const uint8_t **ptr)  { return CALL_IF_EXISTS(size_t, static_cast<SerialT*>(this), rxSpan, ptr); }
+  void rxConsume(serial_index_t, const size_t count)  { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), rxConsume, count); }
   using SerialT::available;
   using SerialT::read;
   using SerialT::flush;
@@ -228,6 +246,12 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     REPEAT(NUM_SERIAL, _S_WRITE);
     #undef _S_WRITE
   }
+  NO_INLINE size_t writeBuffer(const uint8_t *buffer, size_t size) {
+    #define _S_WRITEBUFFER(N) if (portMask.enabled(output[N])) serial_write_buffer(&serial##N, buffer, size);
+    REPEAT(NUM_SERIAL, _S_WRITEBUFFER);
+    #undef _S_WRITEBUFFER
+    return size;
+  }
   NO_INLINE void msgDone() {
     #define _S_DONE(N) if (portMask.enabled(output[N])) serial##N.msgDone();
     REPEAT(NUM_SERIAL, _S_DONE);
@@ -247,6 +271,19 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     #undef _S_READ
     return -1;
   }
+  size_t rxSpan(serial_index_t index, const uint8_t **ptr) {
+    uint8_t pos = offset;
+    #define _S_RXSPAN(N) if (index.within(pos, pos + step - 1)) return CALL_IF_EXISTS(size_t, &serial##N, rxSpan, index, ptr); else pos += step;
+    REPEAT(NUM_SERIAL, _S_RXSPAN);
+    #undef _S_RXSPAN
+    return 0;
+  }
+  void rxConsume(serial_index_t index, const size_t count) {
+    uint8_t pos = offset;
+    #define _S_RXCONSUME(N) if (index.within(pos, pos + step - 1)) return CALL_IF_EXISTS(void, &serial##N, rxConsume, index, count); else pos += step;
+    REPEAT(NUM_SERIAL, _S_RXCONSUME);
+    #undef _S_RXCONSUME
+  }
   void begin(const long br) {
     #define _S_BEGIN(N) if (portMask.enabled(output[N])) serial##N.begin(br);
     REPEAT(NUM_SERIAL, _S_BEGIN);
@@ -28,6 +28,7 @@
 #include "binary_stream.h"
 
 char* SDFileTransferProtocol::Packet::Open::data = nullptr;
+uint32_t SDFileTransferProtocol::Packet::Open::file_size = 0;
 size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
 bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
 
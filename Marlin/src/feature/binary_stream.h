@@ -43,27 +43,40 @@ class SDFileTransferProtocol  {
 private:
   struct Packet {
     struct [[gnu::packed]] Open {
+      // The filename may be followed by the file size (protocol 0.2)
       static bool validate(char *buffer, size_t length) {
-        return (length > sizeof(Open) && buffer[length - 1] == '\0');
+        if (length <= sizeof(Open)) return false;
+        const char * const end = (char*)memchr(&buffer[2], '\0', length - 2);
+        if (!end) return false;
+        const size_t extra = buffer + length - (end + 1);
+        return extra == 0 || extra == sizeof(uint32_t);
       }
-      static Open& decode(char *buffer) {
+      static Open& decode(char *buffer, size_t length) {
         data = &buffer[2];
+        const size_t size_index = 2 + strlen(data) + 1;
+        file_size = 0;
+        if (length == size_index + sizeof(uint32_t))
+          for (uint8_t i = sizeof(uint32_t); i--;) file_size = (file_size << 8) | uint8_t(buffer[size_index + i]);
         return *reinterpret_cast<Open*>(buffer);
       }
       bool compression_enabled() { return compression & 0x1; }
       bool dummy_transfer() { return dummy & 0x1; }
       static char* filename() { return data; }
+      static uint32_t size() { return file_size; } // 0 if not given
       private:
         uint8_t dummy, compression;
         static char* data;  // variable length strings complicate things
+        static uint32_t file_size;
     };
   };
 
-  static bool file_open(char *filename) {
+  static bool file_open(char *filename, const uint32_t size) {
     if (!dummy_transfer) {
       card.mount();
       card.openFileWrite(filename);
       if (!card.isFileOpen()) return false;
+      // Allocate the whole file up front, if the host sent its (uncompressed) size
+      TERN_(SD_WRITE_BEHIND, if (size) card.preallocate(size));
     }
     transfer_active = true;
     data_waiting = 0;
@@ -107,6 +120,7 @@ private:
           data_waiting = 0;
         }
       #endif
+      if (TERN0(SD_WRITE_BEHIND, !card.write_flush())) return false;
       card.closefile();
       card.release();
     }
@@ -158,10 +172,10 @@ public:
           SERIAL_ECHOLNPGM("PFT:busy");
         else {
           if (Packet::Open::validate(buffer, length)) {
-            auto packet = Packet::Open::decode(buffer);
+            auto packet = Packet::Open::decode(buffer, length);
             compression = packet.compression_enabled();
             dummy_transfer = packet.dummy_transfer();
-            if (file_open(packet.filename())) {
+            if (file_open(packet.filename(), packet.size())) {
               SERIAL_ECHOLNPGM("PFT:success");
               break;
             }
@@ -194,7 +208,7 @@ public:
     }
   }
 
-  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
+  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 2, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
 };
 
 class BinaryStream {
@@ -28,6 +28,10 @@
 
 #include "../MarlinCore.h"
 
+#if ENABLED(DIRECT_STEPPING_CRC16)
+  #include "../libs/crc16.h"
+#endif
+
 #define CHECK_PAGE(I, R) do{                                \
   if (I >= sizeof(page_states) / sizeof(page_states[0])) {  \
     fatal_error = true;                                     \
@@ -61,7 +65,7 @@ namespace DirectStepping {
   uint8_t SerialPageManager<Cfg>::pages[Cfg::PAGE_COUNT][Cfg::PAGE_SIZE];
 
   template<typename Cfg>
-  uint8_t SerialPageManager<Cfg>::checksum;
+  TERN(DIRECT_STEPPING_CRC16, uint16_t, uint8_t) SerialPageManager<Cfg>::checksum;
 
   template<typename Cfg>
   typename Cfg::write_byte_idx_t SerialPageManager<Cfg>::write_byte_idx;
@@ -136,7 +140,7 @@ namespace DirectStepping {
         return true;
       case State::COLLECT:
         pages[write_page_idx][write_byte_idx++] = c;
-        checksum ^= c;
+        TERN(DIRECT_STEPPING_CRC16, crc16(&checksum, &c, 1), checksum ^= c);
 
         // check if still collecting
         if (Cfg::PAGE_SIZE == 256) {
@@ -156,7 +160,17 @@ namespace DirectStepping {
 
         state = State::CHECKSUM;
         return true;
-      case State::CHECKSUM: {
+      #if ENABLED(DIRECT_STEPPING_CRC16)
+        case State::CHECKSUM:
+          // CRC16 high byte. A good page leaves only the low byte.
+          checksum ^= uint16_t(c) << 8;
+          state = State::CHECKSUM_LOW;
+          return true;
+        case State::CHECKSUM_LOW:
+      #else
+        case State::CHECKSUM:
+      #endif
+      {
         const PageState page_state = (checksum == c) ? PageState::OK : PageState::FAIL;
         set_page_state(write_page_idx, page_state);
         state = State::MONITOR;
@@ -191,13 +205,15 @@ namespace DirectStepping {
       bits_b[i >> state_bits] |= page_states[i] << ((i * state_bits) & 0x7);
     }
 
-    uint8_t crc = 0;
+    TERN(DIRECT_STEPPING_CRC16, uint16_t, uint8_t) crc = 0;
     for (uint8_t i = 0 ; i < n_bytes ; i++) {
-      crc ^= bits_b[i];
-      SERIAL_CHAR(bits_b[i]);
+      const uint8_t b = bits_b[i];
+      TERN(DIRECT_STEPPING_CRC16, crc16(&crc, &b, 1), crc ^= b);
+      SERIAL_CHAR(b);
     }
 
-    SERIAL_CHAR(crc);
+    TERN_(DIRECT_STEPPING_CRC16, SERIAL_CHAR(uint8_t(crc >> 8)));
+    SERIAL_CHAR(uint8_t(crc));
     SERIAL_EOL();
   }
 
@@ -227,7 +243,7 @@ DirectStepping::PageManager page_manager;
 
 const uint8_t segment_table[DirectStepping::Config::NUM_SEGMENTS][DirectStepping::Config::SEGMENT_STEPS] PROGMEM = {
 
-  #if STEPPER_PAGE_FORMAT == SP_4x4D_128
+  #if STEPPER_PAGE_FORMAT == SP_4x4D_128 || STEPPER_PAGE_FORMAT == SP_4x4DR_128
 
     { 1, 1, 1, 1, 1, 1, 1 }, //  0 = -7
     { 1, 1, 1, 0, 1, 1, 1 }, //  1 = -6
@@ -26,7 +26,7 @@
 namespace DirectStepping {
 
   enum State : char {
-    MONITOR, NEWLINE, ADDRESS, SIZE, COLLECT, CHECKSUM, UNFAIL
+    MONITOR, NEWLINE, ADDRESS, SIZE, COLLECT, CHECKSUM, CHECKSUM_LOW, UNFAIL
   };
 
   enum PageState : uint8_t {
@@ -41,6 +41,8 @@ namespace DirectStepping {
     uint16_t segment_idx;
     // Current steps within segment
     uint8_t segment_steps;
+    // Segment rate, for formats with a rate per segment
+    uint8_t segment_rate;
     // Segment delta
     xyze_uint8_t sd;
     // Block delta
@@ -72,7 +74,7 @@ namespace DirectStepping {
     static volatile bool page_states_dirty;
 
     static uint8_t pages[Cfg::PAGE_COUNT][Cfg::PAGE_SIZE];
-    static uint8_t checksum;
+    static TERN(DIRECT_STEPPING_CRC16, uint16_t, uint8_t) checksum;
     static write_byte_idx_t write_byte_idx;
     static page_idx_t write_page_idx;
     static write_byte_idx_t write_page_size;
@@ -83,7 +85,7 @@ namespace DirectStepping {
   template<bool b, typename T, typename F> struct TypeSelector { typedef T type;} ;
   template<typename T, typename F> struct TypeSelector<false, T, F> { typedef F type; };
 
-  template <int num_pages, int num_axes, int bits_segment, bool dir, int segments>
+  template <int num_pages, int num_axes, int bits_segment, bool dir, int segments, bool seg_rate=false>
   struct config_t {
     static constexpr char CONTROL_CHAR  = '!';
 
@@ -92,11 +94,13 @@ namespace DirectStepping {
     static constexpr int BITS_SEGMENT   = bits_segment;
     static constexpr int DIRECTIONAL    = dir ? 1 : 0;
     static constexpr int SEGMENTS       = segments;
+    static constexpr int SEGMENT_RATE   = seg_rate ? 1 : 0;
 
     static constexpr int NUM_SEGMENTS   = _BV(BITS_SEGMENT);
     static constexpr int SEGMENT_STEPS  = _BV(BITS_SEGMENT - DIRECTIONAL) - 1;
     static constexpr int TOTAL_STEPS    = SEGMENT_STEPS * SEGMENTS;
-    static constexpr int PAGE_SIZE      = (AXIS_COUNT * BITS_SEGMENT * SEGMENTS) / 8;
+    static constexpr int SEGMENT_BYTES  = (AXIS_COUNT * BITS_SEGMENT) / 8 + SEGMENT_RATE;
+    static constexpr int PAGE_SIZE      = (AXIS_COUNT * BITS_SEGMENT * SEGMENTS) / 8 + SEGMENT_RATE * SEGMENTS;
 
     typedef typename TypeSelector<(PAGE_SIZE>256), uint16_t, uint8_t>::type write_byte_idx_t;
     typedef typename TypeSelector<(PAGE_COUNT>256), uint16_t, uint8_t>::type page_idx_t;
@@ -105,6 +109,10 @@ namespace DirectStepping {
   template <uint8_t num_pages>
   using SP_4x4D_128 = config_t<num_pages, 4, 4, true,  128>;
 
+  // As SP_4x4D_128 with a third byte per segment setting the segment step rate
+  template <uint8_t num_pages>
+  using SP_4x4DR_128 = config_t<num_pages, 4, 4, true, 128, true>;
+
   template <uint8_t num_pages>
   using SP_4x2_256  = config_t<num_pages, 4, 2, false, 256>;
 
@@ -123,6 +131,7 @@ namespace DirectStepping {
 //#define SP_4x2D_256 3
 #define SP_4x2_256 4
 #define SP_4x1_512 5
+#define SP_4x4DR_128 6
 
 typedef typename DirectStepping::Config::page_idx_t page_idx_t;
 
@@ -43,7 +43,7 @@
 
 #include "meatpack.h"
 
-#define MeatPack_ProtocolVersion "PV01"
+#define MeatPack_ProtocolVersion TERN(MEATPACK_DICTIONARY, "PV02", "PV01")
 //#define MP_DEBUG
 
 #define DEBUG_OUT ENABLED(MP_DEBUG)
@@ -67,8 +67,70 @@ void MeatPack::reset_state() {
   second_char = 0;
   cmd_count = full_char_count = char_out_count = 0;
   TERN_(MP_DEBUG, chars_decoded = 0);
+  #if ENABLED(MEATPACK_DICTIONARY)
+    clear_tokens();
+    load_step = TokenLoad_None;
+    bytes_in = chars_out = 0;
+  #endif
 }
 
+#if ENABLED(MEATPACK_DICTIONARY)
+
+  void MeatPack::clear_tokens() { ZERO(token_len); }
+
+  /**
+   * Consume one byte of a MPCommand_SetToken payload: <index> <length> <chars...>
+   * A zero length clears the token. Invalid tokens are consumed and dropped.
+   */
+  void MeatPack::handle_token_load(const uint8_t c) {
+    switch (load_step) {
+      case TokenLoad_Index:
+        load_index = c < MEATPACK_DICT_SIZE ? c : 0xFF;
+        load_step = TokenLoad_Length;
+        return;
+
+      case TokenLoad_Length:
+        if (c > MEATPACK_DICT_TOKEN_LEN) load_index = 0xFF;
+        load_len = 0;
+        load_remain = c;
+        if (load_remain) { load_step = TokenLoad_Chars; return; }
+        break;
+
+      case TokenLoad_Chars:
+        if (load_index != 0xFF) token[load_index][load_len++] = c;
+        if (--load_remain) return;
+        break;
+
+      default: return;
+    }
+
+    // All payload bytes received
+    load_step = TokenLoad_None;
+    if (load_index != 0xFF) {
+      token_len[load_index] = load_len;
+      DEBUG_ECHOLNPGM("[MPDBG] TOKEN ", load_index, " LEN ", load_len);
+    }
+    else
+      DEBUG_ECHOLNPGM("[MPDBG] BAD TOKEN");
+    report_state();
+  }
+
+  /**
+   * Output a full-width character, expanding it if it
+   * refers to a token from the dictionary.
+   */
+  void MeatPack::handle_literal_char(const uint8_t c) {
+    const uint8_t i = c - kTokenByte;
+    if (i < MEATPACK_DICT_SIZE && token_len[i]) {
+      for (uint8_t n = 0; n < token_len[i]; ++n)
+        handle_output_char(token[i][n]);
+    }
+    else
+      handle_output_char(c);
+  }
+
+#endif // MEATPACK_DICTIONARY
+
 /**
  * Unpack one or two characters from a packed byte into a buffer.
  * Return flags indicating whether any literal bytes follow.
@@ -118,7 +180,7 @@ void MeatPack::handle_rx_char_inner(const uint8_t c) {
       }
     }
     else {
-      handle_output_char(c);                                // Pass through the character that couldn't be packed...
+      handle_literal_char(c);                               // Pass through the character that couldn't be packed...
       if (second_char) {
         handle_output_char(second_char);                    // ...and send an unpacked 2nd character, if set.
         second_char = 0;
@@ -127,7 +189,7 @@ void MeatPack::handle_rx_char_inner(const uint8_t c) {
     }
   }
   else // Packing not enabled, just copy character to output
-    handle_output_char(c);
+    handle_literal_char(c);
 }
 
 /**
@@ -136,6 +198,7 @@ void MeatPack::handle_rx_char_inner(const uint8_t c) {
  */
 void MeatPack::handle_output_char(const uint8_t c) {
   char_out_buf[char_out_count++] = c;
+  TERN_(MEATPACK_DICTIONARY, ++chars_out);
 
   #if ENABLED(MP_DEBUG)
     if (chars_decoded < 1024) {
@@ -161,6 +224,10 @@ void MeatPack::handle_command(const MeatPack_Command c) {
     case MPCommand_DisableNoSpaces:
       CBI(state, MPConfig_Bit_NoSpaces);
       meatPackLookupTable[kSpaceCharIdx] = ' ';                        DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
+    #if ENABLED(MEATPACK_DICTIONARY)
+      case MPCommand_SetToken:      load_step = TokenLoad_Index;       return; // Report after the payload
+      case MPCommand_ClearTokens:   clear_tokens();                    DEBUG_ECHOLNPGM("[MPDBG] CLR TOK");   break;
+    #endif
     default:                                                           DEBUG_ECHOLNPGM("[MPDBG] UNK CMD REC");
   }
   report_state();
@@ -171,7 +238,16 @@ void MeatPack::report_state() {
   // should not contain the "PV' substring, as this is used to indicate protocol version
   SERIAL_ECHOPGM("[MP] " MeatPack_ProtocolVersion " ");
   serialprint_onoff(TEST(state, MPConfig_Bit_Active));
-  SERIAL_ECHOF(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP\n") : F(" ESP\n"));
+  #if ENABLED(MEATPACK_DICTIONARY)
+    SERIAL_ECHOF(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP") : F(" ESP"));
+    uint8_t tokens = 0;
+    LOOP_L_N(i, MEATPACK_DICT_SIZE) if (token_len[i]) ++tokens;
+    // CR: Ratio of characters queued to stream bytes received
+    SERIAL_ECHOLNPGM(" TOK:", tokens, " RX:", bytes_in, " OUT:", chars_out,
+                     " CR:", bytes_in ? float(chars_out) / bytes_in : 1.0f);
+  #else
+    SERIAL_ECHOF(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP\n") : F(" ESP\n"));
+  #endif
 }
 
 /**
@@ -179,6 +255,15 @@ void MeatPack::report_state() {
  * according to the current meatpack state.
  */
 void MeatPack::handle_rx_char(const uint8_t c, const serial_index_t serial_ind) {
+  #if ENABLED(MEATPACK_DICTIONARY)
+    ++bytes_in;
+    if (load_step) {                      // Receiving a token payload?
+      PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));
+      handle_token_load(c);               // Payload bytes are always raw
+      return;
+    }
+  #endif
+
   if (c == kCommandByte) {                // A command (0xFF) byte?
     if (cmd_count) {                      // In fact, two in a row?
       cmd_is_next = true;                 // Then a MeatPack command follows
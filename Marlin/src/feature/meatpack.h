@@ -70,7 +70,9 @@ enum MeatPack_Command : uint8_t {
   MPCommand_ResetAll        = 0xF9,
   MPCommand_QueryConfig     = 0xF8,
   MPCommand_EnableNoSpaces  = 0xF7,
-  MPCommand_DisableNoSpaces = 0xF6
+  MPCommand_DisableNoSpaces = 0xF6,
+  MPCommand_SetToken        = 0xF5, // Followed by <index> <length> <token chars...>
+  MPCommand_ClearTokens     = 0xF4
 };
 
 enum MeatPack_ConfigStateBits : uint8_t {
@@ -90,13 +92,35 @@ class MeatPack {
   static const uint8_t kSpaceCharIdx = 11;
   static const char kSpaceCharReplace = 'E';
 
+  #if ENABLED(MEATPACK_DICTIONARY)
+    // Dictionary tokens are sent as a single byte 0x80 + index,
+    // either as a literal in packed mode or directly when unpacked.
+    static const uint8_t kTokenByte = 0x80;
+
+    enum TokenLoadStep : uint8_t { TokenLoad_None, TokenLoad_Index, TokenLoad_Length, TokenLoad_Chars };
+
+    char token[MEATPACK_DICT_SIZE][MEATPACK_DICT_TOKEN_LEN];  // Host-loaded tokens
+    uint8_t token_len[MEATPACK_DICT_SIZE];                    // Length of each token, 0 if unset
+    TokenLoadStep load_step;  // Progress of a MPCommand_SetToken payload
+    uint8_t load_index,       // Token being loaded, or 0xFF if invalid
+            load_len,         // Characters stored so far
+            load_remain;      // Characters still to be received
+    uint32_t bytes_in,        // Stream bytes received, for the compression report
+             chars_out;       // Characters produced for the command queue
+  #endif
+
   bool cmd_is_next;        // A command is pending
   uint8_t state;           // Configuration state
   uint8_t second_char;     // Buffers a character if dealing with out-of-sequence pairs
   uint8_t cmd_count,       // Counter of command bytes received (need 2)
           full_char_count, // Counter for full-width characters to be received
           char_out_count;  // Stores number of characters to be read out.
-  uint8_t char_out_buf[2]; // Output buffer for caching up to 2 characters
+public:
+  // Most characters produced by a single stream byte
+  static const uint8_t kMaxOutChars = TERN(MEATPACK_DICTIONARY, _MAX(2, MEATPACK_DICT_TOKEN_LEN + 1), 2);
+
+private:
+  uint8_t char_out_buf[kMaxOutChars]; // Output buffer for caching the unpacked characters
 
 public:
   // Pass in a character rx'd by SD card or serial. Automatically parses command/ctrl sequences,
@@ -105,9 +129,9 @@ public:
 
   /**
    * After passing in rx'd char using above method, call this to get characters out.
-   * Can return from 0 to 2 characters at once.
+   * Can return from 0 to kMaxOutChars characters at once.
    * @param out [in] Output pointer for unpacked/processed data.
-   * @return Number of characters returned. Range from 0 to 2.
+   * @return Number of characters returned. Range from 0 to kMaxOutChars.
    */
   uint8_t get_result_char(char * const __restrict out);
 
@@ -118,7 +142,17 @@ public:
   void handle_output_char(const uint8_t c);
   void handle_rx_char_inner(const uint8_t c);
 
-  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0) {}
+  #if ENABLED(MEATPACK_DICTIONARY)
+    void clear_tokens();
+    void handle_token_load(const uint8_t c);
+    void handle_literal_char(const uint8_t c);
+  #else
+    inline void handle_literal_char(const uint8_t c) { handle_output_char(c); }
+  #endif
+
+  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0) {
+    TERN_(MEATPACK_DICTIONARY, reset_state());
+  }
 };
 
 // Implement the MeatPack serial class so it's transparent to rest of the code
@@ -129,11 +163,12 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
   SerialT & out;
   MeatPack meatpack;
 
-  char serialBuffer[2];
+  char serialBuffer[MeatPack::kMaxOutChars];
   uint8_t charCount;
   uint8_t readIndex;
 
   NO_INLINE void write(uint8_t c)     { out.write(c); }
+  size_t writeBuffer(const uint8_t *buffer, size_t size) { return serial_write_buffer(&out, buffer, size); }
   void flush()                        { out.flush();  }
   void begin(long br)                 { out.begin(br); readIndex = 0; }
   void end()                          { out.end(); }
@@ -44,6 +44,11 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::dwin_flag; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  uint16_t PrintJobRecovery::journal_seq, // = 0
+           PrintJobRecovery::journal_crc;
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -62,6 +67,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #include "../libs/crc16.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
@@ -126,6 +135,7 @@ bool PrintJobRecovery::check() {
  * Delete the recovery file and clear the recovery data
  */
 void PrintJobRecovery::purge() {
+  TERN_(POWER_LOSS_JOURNAL, close());
   init();
   card.removeJobRecoveryFile();
 }
@@ -137,6 +147,7 @@ void PrintJobRecovery::load() {
   if (exists()) {
     open(true);
     (void)file.read(&info, sizeof(info));
+    TERN_(POWER_LOSS_JOURNAL, if (info.valid()) replay());
     close();
   }
   debug(F("Load"));
@@ -147,7 +158,12 @@ void PrintJobRecovery::load() {
  */
 void PrintJobRecovery::prepare() {
   card.getAbsFilenameInCWD(info.sd_filename);  // SD filename
+  TERN_(SD_EXTENT_CACHE, info.sd_first_cluster = card.fileFirstCluster());
   cmd_sdpos = 0;
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    close();          // The card may have been swapped since the last job
+    journal_seq = 0;  // Start the job with a full snapshot
+  #endif
 }
 
 /**
@@ -166,6 +182,10 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     #define POWER_LOSS_MIN_Z_CHANGE 0.05  // Vase-mode-friendly out of the box
   #endif
 
+  #if POWER_LOSS_JOURNAL_MOVES
+    static uint16_t moves; // = 0
+  #endif
+
   // Did Z change since the last call?
   if (force
     #if DISABLED(SAVE_EACH_CMD_MODE)      // Always save state when enabled
@@ -174,20 +194,29 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
       #endif
       // Save if Z is above the last-saved position by some minimum height
       || current_position.z > info.current_position.z + POWER_LOSS_MIN_Z_CHANGE
+      #if POWER_LOSS_JOURNAL_MOVES
+        // Save after some number of moves
+        || ++moves >= POWER_LOSS_JOURNAL_MOVES
+      #endif
     #endif
   ) {
 
     #if SAVE_INFO_INTERVAL_MS > 0
       next_save_ms = ms + SAVE_INFO_INTERVAL_MS;
     #endif
+    #if POWER_LOSS_JOURNAL_MOVES
+      moves = 0;
+    #endif
 
     // Set Head and Foot to matching non-zero values
     if (!++info.valid_head) ++info.valid_head; // non-zero in sequence
     //if (!IS_SD_PRINTING()) info.valid_head = 0;
     info.valid_foot = info.valid_head;
+    info.layout = PLR_LAYOUT_VERSION;
 
     // Machine state
     // info.sdpos and info.current_position are pre-filled from the Stepper ISR
+    TERN_(SD_EXTENT_CACHE, info.sd_cluster = card.indexCluster(info.sdpos));
 
     info.feedrate = uint16_t(MMS_TO_MMM(feedrate_mm_s));
     info.zraise = zraise;
@@ -333,13 +362,126 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    // Append a record unless the rest of the job state changed since the snapshot
+    if (!(journal_seq && file.isOpen() && static_crc() == journal_crc && write_record()))
+      write_snapshot();
+
+  #else
+
+    open(false);
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+
+  #endif
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * The recovery file is preallocated and left open while printing:
+   *
+   *   job_recovery_info_t, padded to a whole block
+   *   POWER_LOSS_JOURNAL_BLOCKS blocks of plr_record_t, written in rotation
+   *
+   * Writing a record in place is a single block write, with no FAT or
+   * directory updates, and spreads the writes over all the journal blocks.
+   */
+  static constexpr uint32_t journal_base = (sizeof(job_recovery_info_t) + 511) & ~511UL,
+                            journal_size = journal_base + (POWER_LOSS_JOURNAL_BLOCKS) * 512UL;
+  static constexpr uint16_t records_per_block = 512 / sizeof(plr_record_t),
+                            journal_records = (POWER_LOSS_JOURNAL_BLOCKS) * records_per_block;
+  static_assert(records_per_block > 0, "The power-loss journal record is too big for a block.");
+
+  static uint32_t record_position(const uint16_t slot) {
+    return journal_base + (slot / records_per_block) * 512UL + (slot % records_per_block) * sizeof(plr_record_t);
+  }
+
+  static uint16_t record_crc(const plr_record_t &rec) {
+    uint16_t crc = 0;
+    crc16(&crc, &rec, offsetof(plr_record_t, crc));
+    return crc;
+  }
+
+  // CRC of the job state outside of the journaled range
+  uint16_t PrintJobRecovery::static_crc() {
+    uint16_t crc = 0;
+    crc16(&crc, &info.sd_filename, offsetof(job_recovery_info_t, valid_foot) - offsetof(job_recovery_info_t, sd_filename));
+    return crc;
+  }
+
+  /**
+   * Write the whole info with a new epoch, making all journal records stale.
+   * Create and preallocate the file as needed.
+   */
+  void PrintJobRecovery::write_snapshot() {
+    journal_seq = 0;
+    if (!file.isOpen()) {
+      open(false);
+      if (!file.isOpen()) return;
+    }
+
+    if (file.fileSize() < journal_size) {
+      const uint8_t zero[16] = { 0 };
+      file.seekEnd();
+      for (uint32_t n = journal_size - file.fileSize(); n;) {
+        const uint16_t len = _MIN(n, uint32_t(sizeof(zero)));
+        if (file.write(zero, len) != int16_t(len)) break;
+        n -= len;
+      }
+    }
+
+    if (!++info.journal_epoch) ++info.journal_epoch;
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1 || !file.sync()) {
+      DEBUG_ECHOLNPGM("Power-loss file write failed.");
+      return;
+    }
+    journal_crc = static_crc();
+    journal_seq = 1;
+  }
+
+  /**
+   * Append the journaled state to the next slot
+   */
+  bool PrintJobRecovery::write_record() {
+    if (journal_seq == 0xFFFF) return false;  // Start a new epoch before 'seq' wraps
+    plr_record_t rec;
+    rec.epoch = info.journal_epoch;
+    rec.seq = ++journal_seq;
+    memcpy(rec.state, &info.current_position, sizeof(rec.state));
+    rec.crc = record_crc(rec);
+    const bool ok = file.seekSet(record_position(rec.seq % journal_records))
+                 && file.write(&rec, sizeof(rec)) == int16_t(sizeof(rec))
+                 && file.sync();
+    if (!ok) DEBUG_ECHOLNPGM("Power-loss journal write failed.");
+    return ok;
+  }
+
+  /**
+   * Apply the newest good record of the loaded epoch
+   */
+  void PrintJobRecovery::replay() {
+    plr_record_t rec;
+    uint16_t best_seq = 0, best_slot = 0;
+    LOOP_L_N(slot, journal_records) {
+      if (!file.seekSet(record_position(slot)) || file.read(&rec, sizeof(rec)) != int16_t(sizeof(rec))) break;
+      if (rec.epoch == info.journal_epoch && rec.seq > best_seq && rec.crc == record_crc(rec)) {
+        best_seq = rec.seq;
+        best_slot = slot;
+      }
+    }
+    if (best_seq && file.seekSet(record_position(best_slot)) && file.read(&rec, sizeof(rec)) == int16_t(sizeof(rec)))
+      memcpy(&info.current_position, rec.state, sizeof(rec.state));
+    DEBUG_ECHOLNPGM("Power-loss journal record: ", best_seq);
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
@@ -348,6 +490,13 @@ void PrintJobRecovery::resume() {
   char cmd[MAX_CMD_SIZE+16], str_1[16], str_2[16];
 
   const uint32_t resume_sdpos = info.sdpos; // Get here before the stepper ISR overwrites it
+  TERN_(SD_EXTENT_CACHE, const uint32_t resume_cluster = info.sd_cluster);
+
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    // Compact the journal into a new snapshot of the recovered state
+    close();
+    write_snapshot();
+  #endif
 
   // Apply the dry-run flag if enabled
   if (info.flag.dryrun) marlin_debug_flags |= MARLIN_DEBUG_DRYRUN;
@@ -585,6 +734,10 @@ void PrintJobRecovery::resume() {
   char *fn = info.sd_filename;
   sprintf_P(cmd, M23_STR, fn);
   gcode.process_subcommands_now(cmd);
+  #if ENABLED(SD_EXTENT_CACHE)
+    // Seek straight to the saved cluster, unless the file has been replaced
+    if (resume_cluster && card.fileFirstCluster() == info.sd_first_cluster) card.hintIndexCluster(resume_sdpos, resume_cluster);
+  #endif
   sprintf_P(cmd, PSTR("M24S%ldT%ld"), resume_sdpos, info.print_job_elapsed);
   gcode.process_subcommands_now(cmd);
 
@@ -686,6 +839,9 @@ void PrintJobRecovery::resume() {
 
         DEBUG_ECHOLNPGM("sd_filename: ", info.sd_filename);
         DEBUG_ECHOLNPGM("sdpos: ", info.sdpos);
+        #if ENABLED(SD_EXTENT_CACHE)
+          DEBUG_ECHOLNPGM("sd_cluster: ", info.sd_cluster, " sd_first_cluster: ", info.sd_first_cluster);
+        #endif
         DEBUG_ECHOLNPGM("print_job_elapsed: ", info.print_job_elapsed);
 
         DEBUG_ECHOPGM("axis_relative:");
@@ -700,6 +856,9 @@ void PrintJobRecovery::resume() {
         DEBUG_ECHOLNPGM("flag.dryrun: ", AS_DIGIT(info.flag.dryrun));
         DEBUG_ECHOLNPGM("flag.allow_cold_extrusion: ", AS_DIGIT(info.flag.allow_cold_extrusion));
         DEBUG_ECHOLNPGM("flag.volumetric_enabled: ", AS_DIGIT(info.flag.volumetric_enabled));
+        #if ENABLED(POWER_LOSS_JOURNAL)
+          DEBUG_ECHOLNPGM("journal_epoch: ", info.journal_epoch, " journal_seq: ", journal_seq);
+        #endif
       }
       else
         DEBUG_ECHOLNPGM("INVALID DATA");
@@ -50,15 +50,68 @@
 //#define SAVE_EACH_CMD_MODE
 //#define SAVE_INFO_INTERVAL_MS 0
 
+// Change when the fields of job_recovery_info_t are rearranged, so older files are rejected
+#define PLR_LAYOUT_VERSION (0x5201 + ENABLED(POWER_LOSS_JOURNAL) + 2 * ENABLED(SD_EXTENT_CACHE))
+
 typedef struct {
   uint8_t valid_head;
+  uint16_t layout;                // PLR_LAYOUT_VERSION when saved
 
-  // Machine state
+  //
+  // Machine state that changes as the print goes on.
+  // With POWER_LOSS_JOURNAL this range is saved as a journal record.
+  //
   xyze_pos_t current_position;
   uint16_t feedrate;
 
   float zraise;
 
+  #if HAS_HOTEND
+    celsius_t target_temperature[HOTENDS];
+  #endif
+  #if HAS_HEATED_BED
+    celsius_t target_temperature_bed;
+  #endif
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(FWRETRACT)
+    float retract[EXTRUDERS], retract_hop;
+  #endif
+
+  // SD position
+  volatile uint32_t sdpos;
+  #if ENABLED(SD_EXTENT_CACHE)
+    uint32_t sd_cluster;          // Cluster holding sdpos, if known
+  #endif
+
+  // Job elapsed time
+  millis_t print_job_elapsed;
+
+  // Misc. Marlin flags
+  struct {
+    bool raised:1;                // Raised before saved
+    bool dryrun:1;                // M111 S8
+    bool allow_cold_extrusion:1;  // M302 P1
+    #if HAS_LEVELING
+      bool leveling:1;            // M420 S
+    #endif
+    #if DISABLED(NO_VOLUMETRICS)
+      bool volumetric_enabled:1;  // M200 S D
+    #endif
+  } flag;
+
+  //
+  // Job state that rarely changes. Must start with sd_filename.
+  //
+
+  // SD Filename
+  char sd_filename[MAXPATHNAMELENGTH];
+  #if ENABLED(SD_EXTENT_CACHE)
+    uint32_t sd_first_cluster;    // To check that sd_cluster belongs to the same file
+  #endif
+
   // Repeat information
   #if ENABLED(GCODE_REPEAT_MARKERS)
     Repeat stored_repeat;
@@ -78,24 +131,10 @@ typedef struct {
     float filament_size[EXTRUDERS];
   #endif
 
-  #if HAS_HOTEND
-    celsius_t target_temperature[HOTENDS];
-  #endif
-  #if HAS_HEATED_BED
-    celsius_t target_temperature_bed;
-  #endif
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
-  #endif
-
   #if HAS_LEVELING
     float fade;
   #endif
 
-  #if ENABLED(FWRETRACT)
-    float retract[EXTRUDERS], retract_hop;
-  #endif
-
   // Mixing extruder and gradient
   #if ENABLED(MIXING_EXTRUDER)
     //uint_fast8_t selected_vtool;
@@ -105,35 +144,37 @@ typedef struct {
     #endif
   #endif
 
-  // SD Filename and position
-  char sd_filename[MAXPATHNAMELENGTH];
-  volatile uint32_t sdpos;
-
-  // Job elapsed time
-  millis_t print_job_elapsed;
-
   // Relative axis modes
   uint8_t axis_relative;
 
-  // Misc. Marlin flags
-  struct {
-    bool raised:1;                // Raised before saved
-    bool dryrun:1;                // M111 S8
-    bool allow_cold_extrusion:1;  // M302 P1
-    #if HAS_LEVELING
-      bool leveling:1;            // M420 S
-    #endif
-    #if DISABLED(NO_VOLUMETRICS)
-      bool volumetric_enabled:1;  // M200 S D
-    #endif
-  } flag;
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    uint16_t journal_epoch;       // Records of other epochs are stale
+  #endif
 
   uint8_t valid_foot;
 
-  bool valid() { return valid_head && valid_head == valid_foot; }
+  bool valid() { return valid_head && valid_head == valid_foot && layout == PLR_LAYOUT_VERSION; }
 
 } job_recovery_info_t;
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  // Bytes of job_recovery_info_t saved in each journal record
+  #define PLR_JOURNAL_STATE_SIZE (offsetof(job_recovery_info_t, sd_filename) - offsetof(job_recovery_info_t, current_position))
+
+  /**
+   * A journal record, appended to the recovery file in rotation after the
+   * full job_recovery_info_t. The one with the highest 'seq' in the current
+   * epoch, and a good CRC, is applied over the full info on load.
+   */
+  typedef struct {
+    uint16_t epoch, seq;
+    uint8_t state[PLR_JOURNAL_STATE_SIZE];
+    uint16_t crc;
+  } plr_record_t;
+
+#endif
+
 class PrintJobRecovery {
   public:
     static const char filename[5];
@@ -212,6 +253,15 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint16_t journal_seq,    //!< Last record written, 0 to write a full snapshot first
+                      journal_crc;    //!< CRC of the job state in the snapshot
+      static uint16_t static_crc();
+      static void write_snapshot();
+      static bool write_record();
+      static void replay();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
@@ -0,0 +1,106 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Temperature Telemetry
+ * Record heater readings and duty in a ring for dumping with M156.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TEMP_TELEMETRY)
+
+#include "temp_telemetry.h"
+
+#include "../module/temperature.h"
+#include "../libs/crc16.h"
+
+TempTelemetry temp_telemetry;
+
+bool TempTelemetry::paused; // = false
+telemetry_sample_t TempTelemetry::samples[TEMP_TELEMETRY_SAMPLES];
+uint8_t TempTelemetry::head, TempTelemetry::count;
+
+static void sample_heater(telemetry_heater_t &t, heater_info_t &h) {
+  t.raw = h.getraw();
+  t.temp = int16_t(LROUND(h.celsius * 10));
+  t.target = h.target;
+  t.pwm = h.pwm_duty();
+}
+
+void TempTelemetry::record() {
+  if (paused) return;
+
+  telemetry_sample_t &s = samples[head];
+  s.ms = uint16_t(millis());
+
+  uint8_t i = 0;
+  #if HAS_HOTEND
+    HOTEND_LOOP() sample_heater(s.heater[i++], thermalManager.temp_hotend[e]);
+  #endif
+  TERN_(HAS_HEATED_BED, sample_heater(s.heater[i++], thermalManager.temp_bed));
+  TERN_(HAS_HEATED_CHAMBER, sample_heater(s.heater[i++], thermalManager.temp_chamber));
+  UNUSED(i);
+
+  if (++head == TEMP_TELEMETRY_SAMPLES) head = 0;
+  if (count < TEMP_TELEMETRY_SAMPLES) count++;
+}
+
+static void write_crc(TempTelemetry::writer_t write, uint16_t &crc, const void * const data, const uint16_t len) {
+  crc16(&crc, data, len);
+  write(data, len);
+}
+
+void TempTelemetry::dump(writer_t write) {
+  uint16_t crc = 0;
+  const uint8_t total = count;
+
+  uint8_t header[6 + TEMP_TELEMETRY_HEATERS] = { 'T', 'L', 'M', TEMP_TELEMETRY_VERSION, TEMP_TELEMETRY_HEATERS, total };
+  uint8_t n = 6;
+  #if HAS_HOTEND
+    HOTEND_LOOP() header[n++] = uint8_t(e);
+  #endif
+  TERN_(HAS_HEATED_BED, header[n++] = uint8_t(H_BED));
+  TERN_(HAS_HEATED_CHAMBER, header[n++] = uint8_t(H_CHAMBER));
+  write_crc(write, crc, header, n);
+
+  uint8_t i = (head + TEMP_TELEMETRY_SAMPLES - total) % (TEMP_TELEMETRY_SAMPLES);
+  LOOP_L_N(j, total) {
+    write_crc(write, crc, &samples[i], sizeof(telemetry_sample_t));
+    if (++i == TEMP_TELEMETRY_SAMPLES) i = 0;
+  }
+
+  write(&crc, sizeof(crc));
+}
+
+static void write_serial(const void * const data, const uint16_t len) {
+  const uint8_t *p = (const uint8_t*)data;
+  LOOP_L_N(i, len) SERIAL_CHAR(char(p[i]));
+}
+
+void TempTelemetry::report() {
+  SERIAL_ECHOLNPGM("Telemetry:", frame_size());
+  dump(write_serial);
+  SERIAL_EOL();
+}
+
+#endif // TEMP_TELEMETRY
@@ -0,0 +1,80 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/temp_telemetry.h
+ *
+ * A ring of the latest heater samples, taken at the rate new readings are ready,
+ * for tuning PID / MPC and for checking thermal protection trips after the fact.
+ *
+ * Frame sent by dump() (little-endian):
+ *   "TLM" <version:1> <heaters:1> <samples:1> <heater id:1 x heaters>
+ *   Samples, oldest first: <ms:2> { <raw:2> <temp x10:2> <target:2> <pwm:1> } x heaters
+ *   <CRC16 of all the above:2>
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define TEMP_TELEMETRY_VERSION 1
+#define TEMP_TELEMETRY_HEATERS (HOTENDS + ENABLED(HAS_HEATED_BED) + ENABLED(HAS_HEATED_CHAMBER))
+
+typedef struct __attribute__((packed)) {
+  raw_adc_t raw;        // Raw ADC (or thermocouple) reading
+  int16_t   temp;       // Temperature in tenths of a degree
+  celsius_t target;     // Target temperature
+  uint8_t   pwm;        // Heater duty as applied (0-127)
+} telemetry_heater_t;
+
+typedef struct __attribute__((packed)) {
+  uint16_t ms;          // Low 16 bits of millis()
+  telemetry_heater_t heater[TEMP_TELEMETRY_HEATERS];
+} telemetry_sample_t;
+
+class TempTelemetry {
+public:
+  typedef void (*writer_t)(const void * const data, const uint16_t len);
+
+  static bool paused;
+
+  // Called when temperatures have been updated from new raw readings
+  static void record();
+  static void clear() { head = count = 0; }
+  static uint8_t size() { return count; }
+
+  // Size of the frame dump() will write
+  static uint16_t frame_size() {
+    return 6 + TEMP_TELEMETRY_HEATERS + uint16_t(count) * sizeof(telemetry_sample_t) + 2;
+  }
+
+  // Write the frame through 'write', oldest sample first
+  static void dump(writer_t write);
+
+  // Send a "Telemetry:<bytes>" line, then the frame, over serial
+  static void report();
+
+private:
+  static telemetry_sample_t samples[TEMP_TELEMETRY_SAMPLES];
+  static uint8_t head, count;
+};
+
+extern TempTelemetry temp_telemetry;
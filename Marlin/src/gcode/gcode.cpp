@@ -541,6 +541,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
           case 34: M34(); break;                                  // M34: Set SD card sorting options
         #endif
 
+        #if ENABLED(SD_IO_STATS)
+          case 39: M39(); break;                                  // M39: SD card I/O statistics and read benchmark
+        #endif
+
         case 928: M928(); break;                                  // M928: Start SD write
       #endif // SDSUPPORT
 
@@ -635,6 +639,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 155: M155(); break;                                  // M155: Set temperature auto-report interval
       #endif
 
+      #if ENABLED(TEMP_TELEMETRY)
+        case 156: M156(); break;                                  // M156: Dump temperature telemetry
+      #endif
+
       #if ENABLED(PARK_HEAD_ON_PAUSE)
         case 125: M125(); break;                                  // M125: Store current position and move to filament change position
       #endif
@@ -807,7 +815,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 305: M305(); break;                                  // M305: Set user thermistor parameters
       #endif
 
-      #if ENABLED(MPCTEMP)
+      #if HAS_MPC
         case 306: M306(); break;                                  // M306: MPC autotune
       #endif
 
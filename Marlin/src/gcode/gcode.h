@@ -109,6 +109,8 @@
  *        The '#' is necessary when calling from within sd files, as it stops buffer prereading
  * M33  - Get the longname version of a path. (Requires LONG_FILENAME_HOST_SUPPORT)
  * M34  - Set SD Card sorting options. (Requires SDCARD_SORT_ALPHA)
+ * M39  - Report SD card I/O statistics, or with 'S<seconds>' set the auto-report interval, 'R' reset them,
+ *        'B<blocks>' run a read benchmark. (Requires SD_IO_STATS)
  *
  * M42  - Change pin status via G-code: M42 P<pin> S<value>. LED pin assumed if P is omitted. (Requires DIRECT_PIN_CONTROL)
  * M43  - Display pin status, watch pins for changes, watch endstops & toggle LED, Z servo probe test, toggle pins (Requires PINS_DEBUGGING)
@@ -172,6 +174,7 @@
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
  * M154 - Auto-report position with interval of S<seconds>. (Requires AUTO_REPORT_POSITION)
  * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
+ * M156 - Dump temperature telemetry over serial or to SD with F. C to clear, S<0|1> to pause/resume. (Requires TEMP_TELEMETRY)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
  * M164 - Commit the mix and save to a virtual tool (current, or as specified by 'S'). (Requires MIXING_EXTRUDER)
  * M165 - Set the mix for the mixing extruder (and current virtual tool) with parameters ABCDHI. (Requires MIXING_EXTRUDER and DIRECT_MIXING_IN_G1)
@@ -216,7 +219,7 @@
  * M303 - PID relay autotune S<temperature> sets the target temperature. Default 150C. (Requires PIDTEMP)
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
- * M306 - MPC autotune. (Requires MPCTEMP)
+ * M306 - MPC autotune. (Requires MPCTEMP, MPCTEMPBED, or MPCTEMPCHAMBER)
  * M309 - Set chamber PID parameters P I and D. (Requires PIDTEMPCHAMBER)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
@@ -664,6 +667,9 @@ private:
     #if BOTH(SDCARD_SORT_ALPHA, SDSORT_GCODE)
       static void M34();
     #endif
+    #if ENABLED(SD_IO_STATS)
+      static void M39();
+    #endif
   #endif
 
   #if ENABLED(DIRECT_PIN_CONTROL)
@@ -809,6 +815,10 @@ private:
     static void M155();
   #endif
 
+  #if ENABLED(TEMP_TELEMETRY)
+    static void M156();
+  #endif
+
   #if ENABLED(MIXING_EXTRUDER)
     static void M163();
     static void M164();
@@ -942,7 +952,7 @@ private:
     static void M305();
   #endif
 
-  #if ENABLED(MPCTEMP)
+  #if HAS_MPC
     static void M306();
     static void M306_report(const bool forReplay=true);
   #endif
@@ -182,6 +182,9 @@ void GcodeSuite::D(const int16_t dcode) {
     case 7: // D7 dump the current serial port type (hence configuration)
       SERIAL_ECHOLNPGM("Current serial configuration RX_BS:", RX_BUFFER_SIZE, ", TX_BS:", TX_BUFFER_SIZE);
       SERIAL_ECHOLN(gtn(&SERIAL_IMPL));
+      #if ENABLED(SERIAL_STATS_TX)
+        SERIAL_ECHOLNPGM("TX dropped:", MYSERIAL1.txDropped(), " blocked:", MYSERIAL1.txBlocked(), "ms");
+      #endif
       break;
 
     case 100: { // D100 Disable heaters and attempt a hard hang (Watchdog Test)
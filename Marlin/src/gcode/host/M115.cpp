@@ -189,6 +189,9 @@ void GcodeSuite::M115() {
     // MEATPACK Compression
     cap_line(F("MEATPACK"), SERIAL_IMPL.has_feature(port, SerialFeature::MeatPack));
 
+    // MEATPACK v2 Token Dictionary
+    cap_line(F("MEATPACK_DICT"), TERN0(MEATPACK_DICTIONARY, SERIAL_IMPL.has_feature(port, SerialFeature::MeatPack)));
+
     // CONFIG_EXPORT
     cap_line(F("CONFIG_EXPORT"), ENABLED(CONFIGURATION_EMBEDDING));
 
@@ -390,6 +390,124 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+/**
+ * Check a complete line received on a serial port before it is queued:
+ * line number and checksum, stopped state, and critical commands.
+ * Return false if the line was rejected and a resend was requested.
+ */
+bool GCodeQueue::validate_serial_line(char * const line, const serial_index_t p) {
+  char* command = line;
+
+  while (*command == ' ') command++;                   // Skip leading spaces
+  char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
+
+  if (npos) {
+
+    const bool M110 = !!strstr_P(command, PSTR("M110"));
+
+    if (M110) {
+      char* n2pos = strchr(command + 4, 'N');
+      if (n2pos) npos = n2pos;
+    }
+
+    const long gcode_N = strtol(npos + 1, nullptr, 10);
+
+    if (gcode_N != serial_state[p.index].last_N + 1 && !M110) {
+      // In case of error on a serial port, don't prevent other serial port from making progress
+      gcode_line_error(F(STR_ERR_LINE_NO), p);
+      return false;
+    }
+
+    char *apos = strrchr(command, '*');
+    if (apos) {
+      uint8_t checksum = 0, count = uint8_t(apos - command);
+      while (count) checksum ^= command[--count];
+      if (strtol(apos + 1, nullptr, 10) != checksum) {
+        // In case of error on a serial port, don't prevent other serial port from making progress
+        gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+        return false;
+      }
+    }
+    else {
+      // In case of error on a serial port, don't prevent other serial port from making progress
+      gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
+      return false;
+    }
+
+    serial_state[p.index].last_N = gcode_N;
+  }
+  #if ENABLED(SDSUPPORT)
+    // Pronterface "M29" and "M29 " has no line number
+    else if (card.flag.saving && !is_M29(command)) {
+      gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
+      return false;
+    }
+  #endif
+
+  //
+  // Movement commands give an alert when the machine is stopped
+  //
+
+  if (IsStopped()) {
+    char* gpos = strchr(command, 'G');
+    if (gpos) {
+      switch (strtol(gpos + 1, nullptr, 10)) {
+        case 0 ... 1:
+        TERN_(ARC_SUPPORT, case 2 ... 3:)
+        TERN_(BEZIER_CURVE_SUPPORT, case 5:)
+          PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
+          SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+          LCD_MESSAGE(MSG_STOPPED);
+          break;
+      }
+    }
+  }
+
+  #if DISABLED(EMERGENCY_PARSER)
+    // Process critical commands early
+    if (command[0] == 'M') switch (command[3]) {
+      case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_MARLINUI_MENU, wait_for_user = false); } break;
+      case '2': if (command[2] == '1' && command[1] == '1') kill(FPSTR(M112_KILL_STR), nullptr, true); break;
+      case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
+    }
+  #endif
+
+  return true;
+}
+
+#if ENABLED(SERIAL_RX_ZERO_COPY)
+
+  /**
+   * Take a whole line straight out of the port's receive buffer, copying
+   * it once into the command buffer 'dst'. Only simple lines qualify: they
+   * must be contiguous in the receive buffer, complete with EOL, and free of
+   * comments, escapes, quotes and backspaces. Anything else returns 'false'
+   * so the character-by-character parser can handle it.
+   */
+  static bool read_serial_line(const serial_index_t p, char (&dst)[MAX_CMD_SIZE]) {
+    const uint8_t *span;
+    const size_t len = CALL_IF_EXISTS(size_t, &SERIAL_IMPL, rxSpan, p, &span);
+
+    size_t i = 0;
+    for (; i < len; i++) {
+      const char c = span[i];
+      if (ISEOL(c)) break;
+      if (c == ';' || c == '\\' || c == 0x08
+        || TERN0(PAREN_COMMENTS, c == '(')
+        || TERN0(GCODE_QUOTED_STRINGS, c == '"')
+        || i >= MAX_CMD_SIZE - 2
+      ) return false;
+    }
+    if (i == 0 || i == len) return false;   // Empty, incomplete, or wrapped line
+
+    memcpy(dst, span, i);
+    dst[i] = '\0';
+    CALL_IF_EXISTS(void, &SERIAL_IMPL, rxConsume, p, i + 1);
+    return true;
+  }
+
+#endif
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -433,6 +551,23 @@ void GCodeQueue::get_serial_commands() {
       // Ok, we have some data to process, let's make progress here
       hadData = true;
 
+      SerialState &serial = serial_state[p];
+
+      #if ENABLED(SERIAL_RX_ZERO_COPY)
+        // At the start of a line try to parse it in place, straight into the queue
+        if (serial.count == 0 && serial.input_state == PS_NORMAL) {
+          char (&command)[MAX_CMD_SIZE] = ring_buffer.commands[ring_buffer.index_w].buffer;
+          if (read_serial_line(p, command)) {
+            if (!validate_serial_line(command, p)) break;
+            #if NO_TIMEOUTS > 0
+              last_command_time = ms;
+            #endif
+            ring_buffer.commit_command(false OPTARG(HAS_MULTI_SERIAL, p));
+            continue;
+          }
+        }
+      #endif
+
       const int c = read_serial(p);
       if (c < 0) {
         // This should never happen, let's log it
@@ -445,7 +580,6 @@ void GCodeQueue::get_serial_commands() {
       }
 
       const char serial_char = (char)c;
-      SerialState &serial = serial_state[p];
 
       if (ISEOL(serial_char)) {
 
@@ -453,81 +587,8 @@ void GCodeQueue::get_serial_commands() {
         if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
           continue;
 
-        char* command = serial.line_buffer;
-
-        while (*command == ' ') command++;                   // Skip leading spaces
-        char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
-
-        if (npos) {
-
-          const bool M110 = !!strstr_P(command, PSTR("M110"));
-
-          if (M110) {
-            char* n2pos = strchr(command + 4, 'N');
-            if (n2pos) npos = n2pos;
-          }
-
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
-
-          if (gcode_N != serial.last_N + 1 && !M110) {
-            // In case of error on a serial port, don't prevent other serial port from making progress
-            gcode_line_error(F(STR_ERR_LINE_NO), p);
-            break;
-          }
-
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
-              // In case of error on a serial port, don't prevent other serial port from making progress
-              gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
-              break;
-            }
-          }
-          else {
-            // In case of error on a serial port, don't prevent other serial port from making progress
-            gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
-
-          serial.last_N = gcode_N;
-        }
-        #if ENABLED(SDSUPPORT)
-          // Pronterface "M29" and "M29 " has no line number
-          else if (card.flag.saving && !is_M29(command)) {
-            gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
-        #endif
-
-        //
-        // Movement commands give an alert when the machine is stopped
-        //
-
-        if (IsStopped()) {
-          char* gpos = strchr(command, 'G');
-          if (gpos) {
-            switch (strtol(gpos + 1, nullptr, 10)) {
-              case 0 ... 1:
-              TERN_(ARC_SUPPORT, case 2 ... 3:)
-              TERN_(BEZIER_CURVE_SUPPORT, case 5:)
-                PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
-                SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
-                LCD_MESSAGE(MSG_STOPPED);
-                break;
-            }
-          }
-        }
-
-        #if DISABLED(EMERGENCY_PARSER)
-          // Process critical commands early
-          if (command[0] == 'M') switch (command[3]) {
-            case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_MARLINUI_MENU, wait_for_user = false); } break;
-            case '2': if (command[2] == '1' && command[1] == '1') kill(FPSTR(M112_KILL_STR), nullptr, true); break;
-            case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
-          }
-        #endif
+        // Validate the line, or exit the loop so other ports can make progress
+        if (!validate_serial_line(serial.line_buffer, p)) break;
 
         #if NO_TIMEOUTS > 0
           last_command_time = ms;
@@ -557,11 +618,17 @@ void GCodeQueue::get_serial_commands() {
     // Get commands if there are more in the file
     if (!IS_SD_FETCHING()) return;
 
+    #if ENABLED(SD_IO_STATS)
+      const uint32_t start_us = micros();
+      uint32_t fetched = 0;
+    #endif
+
     int sd_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+      TERN_(SD_IO_STATS, if (n >= 0) ++fetched);
 
       CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
       const char sd_char = (char)n;
@@ -594,6 +661,11 @@ void GCodeQueue::get_serial_commands() {
       else
         process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
     }
+
+    #if ENABLED(SD_IO_STATS)
+      SdStats::fetch_bytes += fetched;
+      SdStats::fetch_us += micros() - start_us;
+    #endif
   }
 
 #endif // SDSUPPORT
@@ -262,6 +262,8 @@ private:
 
   static void gcode_line_error(FSTR_P const ferr, const serial_index_t serial_ind);
 
+  static bool validate_serial_line(char * const line, const serial_index_t p);
+
   friend class GcodeSuite;
 };
 
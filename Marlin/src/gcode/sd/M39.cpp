@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SD_IO_STATS)
+
+#include "../gcode.h"
+#include "../../sd/cardreader.h"
+
+/**
+ * M39: SD card I/O statistics
+ *
+ *   S<seconds> : Report the statistics every <seconds> seconds (0 to stop)
+ *   R          : Reset the statistics
+ *   B<blocks>  : Run a sequential and random read benchmark of <blocks> blocks (default 1024)
+ *
+ * With no parameters, report the statistics.
+ */
+void GcodeSuite::M39() {
+  if (parser.seenval('S')) {
+    SdStats::auto_reporter.set_interval(parser.value_byte());
+    return;
+  }
+
+  if (parser.seen('B')) {
+    card.read_benchmark(parser.ushortval('B', 1024));
+    return;
+  }
+
+  if (parser.seen('R'))
+    SdStats::reset();
+  else
+    SdStats::report();
+}
+
+#endif // SD_IO_STATS
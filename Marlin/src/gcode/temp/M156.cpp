@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(TEMP_TELEMETRY)
+
+#include "../gcode.h"
+#include "../../feature/temp_telemetry.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../../sd/cardreader.h"
+#endif
+
+#if ENABLED(SDSUPPORT)
+  static void telemetry_to_file(const void * const data, const uint16_t len) {
+    card.write((void*)data, len);
+  }
+#endif
+
+/**
+ * M156: Temperature Telemetry
+ *
+ *   S<0|1> - Pause (0) or resume (1) recording
+ *   C      - Clear all recorded samples
+ *   F      - Write the samples to TELEMTRY.BIN on the SD card
+ *
+ * With no parameters send the samples over serial as a "Telemetry:<bytes>"
+ * line followed by the binary frame described in feature/temp_telemetry.h.
+ */
+void GcodeSuite::M156() {
+  if (parser.seen('S')) temp_telemetry.paused = !parser.value_bool();
+  if (parser.seen_test('C')) temp_telemetry.clear();
+
+  if (parser.seen_test('F')) {
+    #if ENABLED(SDSUPPORT)
+      if (card.isFileOpen()) {
+        SERIAL_ERROR_MSG("Telemetry: SD file in use.");
+        return;
+      }
+      if (!card.isMounted()) card.mount();
+      char fname[] = "TELEMTRY.BIN";
+      card.openFileWrite(fname);
+      if (!card.isFileOpen()) {
+        SERIAL_ERROR_MSG("Telemetry: Failed to open ", fname, " to write.");
+        return;
+      }
+      temp_telemetry.dump(telemetry_to_file);
+      card.closefile();
+      SERIAL_ECHOLNPGM("Telemetry: ", temp_telemetry.size(), " samples saved.");
+    #else
+      SERIAL_ERROR_MSG("Telemetry: No SD support.");
+    #endif
+    return;
+  }
+
+  if (parser.seen("CS")) return;
+
+  temp_telemetry.report();
+}
+
+#endif // TEMP_TELEMETRY
@@ -42,6 +42,10 @@
  *  C<cycles>       Number of times to repeat the procedure. (Minimum: 3, Default: 5)
  *  U<bool>         Flag to apply the result to the current PID values
  *
+ * With PID_AUTOTUNE_CONCURRENT:
+ *  B               Tune in the background and return at once. Use 'S0' to cancel.
+ *                  Several heaters can be tuned at the same time.
+ *
  * With PID_DEBUG, PID_BED_DEBUG, or PID_CHAMBER_DEBUG:
  *  D               Toggle PID debugging and EXIT without further action.
  */
@@ -89,6 +93,16 @@ void GcodeSuite::M303() {
     if (seenS) { if (hid == H_BED) HMI_data.BedPidT = temp; else HMI_data.HotendPidT = temp; }
   #endif
 
+  #if ENABLED(PID_AUTOTUNE_CONCURRENT)
+    if (parser.seen_test('B')) {
+      if (seenS && temp == 0)
+        thermalManager.PID_autotune_cancel(hid);
+      else
+        thermalManager.PID_autotune_start(temp, hid, c, u);
+      return;
+    }
+  #endif
+
   #if DISABLED(BUSY_WHILE_HEATING)
     KEEPALIVE_STATE(NOT_BUSY);
   #endif
@@ -22,61 +22,101 @@
 
 #include "../../inc/MarlinConfig.h"
 
-#if ENABLED(MPCTEMP)
+#if HAS_MPC
 
 #include "../gcode.h"
 #include "../../module/temperature.h"
+#include "../../module/motion.h"
 
 /**
  * M306: MPC settings and autotune
  *
- *  T                         Autotune the active extruder.
+ *  T                         Autotune the active extruder, or the bed or chamber with E-1 or E-2.
+ *                            A hotend E other than the active extruder is rejected.
  *
  *  A<watts/kelvin>           Ambient heat transfer coefficient (no fan).
  *  C<joules/kelvin>          Block heat capacity.
- *  E<extruder>               Extruder number to set. (Default: E0)
+ *  E<extruder>               Extruder number to set. (Default: E0) Use E-1 for the bed, E-2 for the chamber.
  *  F<watts/kelvin>           Ambient heat transfer coefficient (fan on full).
  *  H<joules/kelvin/mm>       Filament heat capacity per mm.
  *  P<watts>                  Heater power.
  *  R<kelvin/second/kelvin>   Sensor responsiveness (= transfer coefficient / heat capcity).
  */
 
+static MPC_t* mpc_constants(const heater_id_t hid) {
+  switch (hid) {
+    #if ENABLED(MPCTEMP)
+      case 0 ... HOTENDS - 1: return &thermalManager.temp_hotend[hid].constants;
+    #endif
+    #if ENABLED(MPCTEMPBED)
+      case H_BED: return &thermalManager.temp_bed.constants;
+    #endif
+    #if ENABLED(MPCTEMPCHAMBER)
+      case H_CHAMBER: return &thermalManager.temp_chamber.constants;
+    #endif
+    default: return nullptr;
+  }
+}
+
 void GcodeSuite::M306() {
-  if (parser.seen_test('T')) { thermalManager.MPC_autotune(); return; }
+  const heater_id_t hid = (heater_id_t)parser.intval('E', TERN(MPCTEMP, H_E0, TERN(MPCTEMPBED, H_BED, H_CHAMBER)));
+
+  if (parser.seen_test('T')) {
+    thermalManager.MPC_autotune(TERN(MPCTEMP, parser.seen('E') ? hid : heater_id_t(active_extruder), hid));
+    return;
+  }
 
   if (parser.seen("ACFPRH")) {
-    const heater_id_t hid = (heater_id_t)parser.intval('E', 0);
-    MPC_t &constants = thermalManager.temp_hotend[hid].constants;
+    MPC_t * const c = mpc_constants(hid);
+    if (!c) { SERIAL_ECHO_MSG(STR_INVALID_EXTRUDER); return; }
+    MPC_t &constants = *c;
     if (parser.seenval('P')) constants.heater_power = parser.value_float();
     if (parser.seenval('C')) constants.block_heat_capacity = parser.value_float();
     if (parser.seenval('R')) constants.sensor_responsiveness = parser.value_float();
     if (parser.seenval('A')) constants.ambient_xfer_coeff_fan0 = parser.value_float();
-    #if ENABLED(MPC_INCLUDE_FAN)
-      if (parser.seenval('F')) constants.fan255_adjustment = parser.value_float() - constants.ambient_xfer_coeff_fan0;
-    #endif
-    if (parser.seenval('H')) constants.filament_heat_capacity_permm = parser.value_float();
+    if (hid >= 0) {
+      #if ENABLED(MPC_INCLUDE_FAN)
+        if (parser.seenval('F')) constants.fan255_adjustment = parser.value_float() - constants.ambient_xfer_coeff_fan0;
+      #endif
+      if (parser.seenval('H')) constants.filament_heat_capacity_permm = parser.value_float();
+    }
     return;
   }
 
   M306_report(true);
 }
 
-void GcodeSuite::M306_report(const bool forReplay/*=true*/) {
-  report_heading(forReplay, F("Model predictive control"));
-  HOTEND_LOOP() {
-    report_echo_start(forReplay);
-    MPC_t& constants = thermalManager.temp_hotend[e].constants;
-    SERIAL_ECHOPGM("  M306 E", e);
-    SERIAL_ECHOPAIR_F(" P", constants.heater_power, 2);
-    SERIAL_ECHOPAIR_F(" C", constants.block_heat_capacity, 2);
-    SERIAL_ECHOPAIR_F(" R", constants.sensor_responsiveness, 4);
-    SERIAL_ECHOPAIR_F(" A", constants.ambient_xfer_coeff_fan0, 4);
+static void M306_report_constants(const int8_t e, const MPC_t &constants) {
+  SERIAL_ECHOPGM("  M306 E", e);
+  SERIAL_ECHOPAIR_F(" P", constants.heater_power, 2);
+  SERIAL_ECHOPAIR_F(" C", constants.block_heat_capacity, 2);
+  SERIAL_ECHOPAIR_F(" R", constants.sensor_responsiveness, 4);
+  SERIAL_ECHOPAIR_F(" A", constants.ambient_xfer_coeff_fan0, 4);
+  if (e >= 0) {
     #if ENABLED(MPC_INCLUDE_FAN)
       SERIAL_ECHOPAIR_F(" F", constants.ambient_xfer_coeff_fan0 + constants.fan255_adjustment, 4);
     #endif
     SERIAL_ECHOPAIR_F(" H", constants.filament_heat_capacity_permm, 4);
-    SERIAL_EOL();
   }
+  SERIAL_EOL();
+}
+
+void GcodeSuite::M306_report(const bool forReplay/*=true*/) {
+  report_heading(forReplay, F("Model predictive control"));
+  #if ENABLED(MPCTEMP)
+    HOTEND_LOOP() {
+      report_echo_start(forReplay);
+      M306_report_constants(e, thermalManager.temp_hotend[e].constants);
+    }
+  #endif
+  #if ENABLED(MPCTEMPBED)
+    report_echo_start(forReplay);
+    M306_report_constants(H_BED, thermalManager.temp_bed.constants);
+  #endif
+  #if ENABLED(MPCTEMPCHAMBER)
+    report_echo_start(forReplay);
+    M306_report_constants(H_CHAMBER, thermalManager.temp_chamber.constants);
+  #endif
 }
 
-#endif // MPCTEMP
+#endif // HAS_MPC
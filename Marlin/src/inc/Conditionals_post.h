@@ -462,6 +462,8 @@
   #if DISABLED(USB_FLASH_DRIVE_SUPPORT) || BOTH(MULTI_VOLUME, VOLUME_SD_ONBOARD)
     #if ENABLED(SDIO_SUPPORT)
       #define NEED_SD2CARD_SDIO 1
+    #elif defined(__PLAT_LINUX__)
+      #define NEED_SD2CARD_FILE 1
     #else
       #define NEED_SD2CARD_SPI 1
     #endif
@@ -471,6 +473,11 @@
     #define REINIT_NOISY_LCD 1  // Have the LCD re-init on SD insertion
   #endif
 
+  // Put the prefetch cache at the end of the SPI flash by default
+  #if BOTH(SD_PREFETCH_CACHE, SD_PREFETCH_SPI_FLASH) && !defined(SD_PREFETCH_FLASH_ADDR) && defined(SPI_FLASH_SIZE)
+    #define SD_PREFETCH_FLASH_ADDR ((SPI_FLASH_SIZE) - (SD_PREFETCH_FLASH_SIZE))
+  #endif
+
 #endif
 
 /**
@@ -2525,6 +2532,7 @@
   #define BED_MAX_TARGET (BED_MAXTEMP - (BED_OVERSHOOT))
 #else
   #undef PIDTEMPBED
+  #undef MPCTEMPBED
 #endif
 
 #if HAS_TEMP_COOLER && PIN_EXISTS(COOLER)
@@ -2552,6 +2560,7 @@
   #define CHAMBER_MAX_TARGET (CHAMBER_MAXTEMP - (CHAMBER_OVERSHOOT))
 #else
   #undef PIDTEMPCHAMBER
+  #undef MPCTEMPCHAMBER
 #endif
 
 // PID heating
@@ -2559,6 +2568,20 @@
   #define HAS_PID_HEATING 1
 #endif
 
+// Model predictive control
+#if ANY(MPCTEMP, MPCTEMPBED, MPCTEMPCHAMBER)
+  #define HAS_MPC 1
+  #ifndef MPC_SMOOTHING_FACTOR
+    #define MPC_SMOOTHING_FACTOR 0.5f
+  #endif
+  #ifndef MPC_MIN_AMBIENT_CHANGE
+    #define MPC_MIN_AMBIENT_CHANGE 1.0f
+  #endif
+  #ifndef MPC_STEADYSTATE
+    #define MPC_STEADYSTATE 0.5f
+  #endif
+#endif
+
 // Thermal protection
 #if !HAS_HEATED_BED
   #undef THERMAL_PROTECTION_BED
@@ -2660,7 +2683,7 @@
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS, SD_IO_STATS)
   #define HAS_AUTO_REPORTING 1
 #endif
 
@@ -768,6 +768,9 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
 #elif ANY(SERIAL_XON_XOFF, SERIAL_STATS_MAX_RX_QUEUED, SERIAL_STATS_DROPPED_RX)
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
+#if ENABLED(SERIAL_STATS_TX) && !defined(__PLAT_LINUX__)
+  #error "SERIAL_STATS_TX is currently only supported on LINUX."
+#endif
 
 /**
  * Multiple Stepper Drivers Per Axis
@@ -939,6 +942,49 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
       #warning "SDSORT_CACHE_VFATS was reduced to MAX_VFAT_ENTRIES!"
     #endif
   #endif
+
+  #if ENABLED(SDSORT_INDEX)
+    #if ENABLED(SDCARD_READONLY)
+      #error "SDSORT_INDEX requires a writable card. Disable SDCARD_READONLY."
+    #elif ENABLED(SDSORT_USES_RAM)
+      #error "SDSORT_INDEX replaces SDSORT_USES_RAM. Disable one or the other."
+    #endif
+  #endif
+#elif ENABLED(SDSORT_INDEX)
+  #error "SDSORT_INDEX requires SDCARD_SORT_ALPHA."
+#endif
+
+#if ENABLED(SD_READ_AHEAD) && !WITHIN(SD_READ_AHEAD_BLOCKS, 2, 16)
+  #error "SD_READ_AHEAD_BLOCKS must be between 2 and 16."
+#endif
+#if ENABLED(SD_PREFETCH_CACHE)
+  #if DISABLED(SD_READ_AHEAD)
+    #error "SD_PREFETCH_CACHE requires SD_READ_AHEAD."
+  #elif ENABLED(SD_PREFETCH_SPI_FLASH)
+    #if !HAS_SPI_FLASH
+      #error "SD_PREFETCH_SPI_FLASH requires a board with SPI flash (HAS_SPI_FLASH)."
+    #elif ENABLED(TFT_LVGL_UI)
+      #error "SD_PREFETCH_SPI_FLASH can't be used with TFT_LVGL_UI, which reads its assets from the SPI flash during erase and program."
+    #elif !defined(SD_PREFETCH_FLASH_ADDR)
+      #error "SD_PREFETCH_SPI_FLASH requires SD_PREFETCH_FLASH_ADDR for this board."
+    #elif SD_PREFETCH_FLASH_SIZE < 8192 || (SD_PREFETCH_FLASH_SIZE) % 4096 || (SD_PREFETCH_FLASH_ADDR) % 4096
+      #error "SD_PREFETCH_FLASH_SIZE must be a multiple of 4096 (at least 8192) and SD_PREFETCH_FLASH_ADDR must be 4096-aligned."
+    #elif defined(SPI_FLASH_SIZE) && (SD_PREFETCH_FLASH_ADDR) + (SD_PREFETCH_FLASH_SIZE) > (SPI_FLASH_SIZE)
+      #error "The SD_PREFETCH_FLASH_ADDR region extends past the end of the SPI flash (SPI_FLASH_SIZE)."
+    #endif
+  #elif SD_PREFETCH_RAM_SIZE < 8192 || (SD_PREFETCH_RAM_SIZE) % 4096
+    #error "SD_PREFETCH_RAM_SIZE must be a multiple of 4096 (at least 8192)."
+  #endif
+#endif
+#if ENABLED(SD_EXTENT_CACHE) && !WITHIN(SD_EXTENT_CACHE_SIZE, 2, 255)
+  #error "SD_EXTENT_CACHE_SIZE must be between 2 and 255."
+#endif
+#if ENABLED(SD_WRITE_BEHIND)
+  #if ENABLED(SDCARD_READONLY)
+    #error "SD_WRITE_BEHIND is incompatible with SDCARD_READONLY."
+  #elif !WITHIN(SD_WRITE_BEHIND_BLOCKS, 2, 16)
+    #error "SD_WRITE_BEHIND_BLOCKS must be between 2 and 16."
+  #endif
 #endif
 
 #if defined(EVENT_GCODE_SD_ABORT) && DISABLED(NOZZLE_PARK_FEATURE)
@@ -1461,8 +1507,102 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
 /**
  * Bed Heating Options - PID vs Limit Switching
  */
-#if BOTH(PIDTEMPBED, BED_LIMIT_SWITCHING)
+#if BOTH(PIDTEMPBED, MPCTEMPBED)
+  #error "Only enable PIDTEMPBED or MPCTEMPBED, but not both."
+#elif BOTH(PIDTEMPBED, BED_LIMIT_SWITCHING)
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
+#elif BOTH(MPCTEMPBED, BED_LIMIT_SWITCHING)
+  #error "To use BED_LIMIT_SWITCHING you must disable MPCTEMPBED."
+#endif
+
+/**
+ * Dynamic Volumetric Limit
+ */
+#if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC)
+  #if !HAS_HOTEND
+    #error "VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC requires a hotend."
+  #elif !WITHIN(DYNAMIC_LIMIT_MAX_DUTY, 1, 100)
+    #error "DYNAMIC_LIMIT_MAX_DUTY must be between 1 and 100."
+  #elif !WITHIN(DYNAMIC_LIMIT_DECREASE, 1, 100)
+    #error "DYNAMIC_LIMIT_DECREASE must be between 1 and 100."
+  #elif !(DYNAMIC_LIMIT_RECOVER > 0)
+    #error "DYNAMIC_LIMIT_RECOVER must be greater than 0."
+  #elif !(DYNAMIC_LIMIT_TARGET_GRACE >= 0)
+    #error "DYNAMIC_LIMIT_TARGET_GRACE must be 0 or more."
+  #endif
+#endif
+
+/**
+ * Extrusion Feed-Forward
+ */
+#if ENABLED(HOTEND_FEEDFORWARD)
+  #if NONE(PIDTEMP, MPCTEMP)
+    #error "HOTEND_FEEDFORWARD requires PIDTEMP or MPCTEMP."
+  #elif !HAS_EXTRUDERS
+    #error "HOTEND_FEEDFORWARD requires at least one extruder."
+  #elif !(FEEDFORWARD_LOOKAHEAD_MS > 0)
+    #error "FEEDFORWARD_LOOKAHEAD_MS must be greater than 0."
+  #elif ENABLED(PIDTEMP) && !(HOTEND_HEATER_WATTS > 0)
+    #error "HOTEND_FEEDFORWARD with PIDTEMP requires HOTEND_HEATER_WATTS greater than 0."
+  #elif ENABLED(PID_EXTRUSION_SCALING)
+    #error "HOTEND_FEEDFORWARD and PID_EXTRUSION_SCALING both add heat for extrusion. Enable only one."
+  #endif
+#endif
+
+/**
+ * Hardware PWM Heaters
+ */
+#if ENABLED(HEATER_HARDWARE_PWM)
+  #if ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_HARDWARE_PWM cannot be used with SLOW_PWM_HEATERS."
+  #elif !WITHIN(HEATER_PWM_RESOLUTION, 8, 16)
+    #error "HEATER_PWM_RESOLUTION must be between 8 and 16."
+  #elif !(HEATER_PWM_FREQUENCY > 0)
+    #error "HEATER_PWM_FREQUENCY must be greater than 0."
+  #endif
+#endif
+
+/**
+ * Heater Power Budget
+ */
+#if ENABLED(HEATER_POWER_BUDGET)
+  #if !(HEATER_POWER_LIMIT > 0)
+    #error "HEATER_POWER_LIMIT (the average power allowed for heaters) must be greater than 0."
+  #elif HAS_HOTEND && DISABLED(MPCTEMP) && !defined(HOTEND_HEATER_WATTS)
+    #error "HEATER_POWER_BUDGET requires HOTEND_HEATER_WATTS."
+  #elif HAS_HEATED_BED && DISABLED(MPCTEMPBED) && !defined(BED_HEATER_WATTS)
+    #error "HEATER_POWER_BUDGET requires BED_HEATER_WATTS."
+  #elif HAS_HEATED_CHAMBER && DISABLED(MPCTEMPCHAMBER) && !defined(CHAMBER_HEATER_WATTS)
+    #error "HEATER_POWER_BUDGET requires CHAMBER_HEATER_WATTS."
+  #endif
+#endif
+
+/**
+ * Background PID Autotune
+ */
+#if ENABLED(PID_AUTOTUNE_CONCURRENT)
+  #if !HAS_PID_HEATING
+    #error "PID_AUTOTUNE_CONCURRENT requires PIDTEMP, PIDTEMPBED, or PIDTEMPCHAMBER."
+  #elif !(HEATER_POWER_LIMIT > 0)
+    #error "PID_AUTOTUNE_CONCURRENT requires HEATER_POWER_LIMIT greater than 0."
+  #elif ENABLED(PIDTEMP) && !(HOTEND_HEATER_WATTS > 0)
+    #error "PID_AUTOTUNE_CONCURRENT requires HOTEND_HEATER_WATTS greater than 0."
+  #elif ENABLED(PIDTEMPBED) && !(BED_HEATER_WATTS > 0)
+    #error "PID_AUTOTUNE_CONCURRENT requires BED_HEATER_WATTS greater than 0."
+  #elif ENABLED(PIDTEMPCHAMBER) && !(CHAMBER_HEATER_WATTS > 0)
+    #error "PID_AUTOTUNE_CONCURRENT requires CHAMBER_HEATER_WATTS greater than 0."
+  #endif
+#endif
+
+/**
+ * Temperature Telemetry
+ */
+#if ENABLED(TEMP_TELEMETRY)
+  #if !ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER)
+    #error "TEMP_TELEMETRY requires a hotend, heated bed, or heated chamber."
+  #elif !WITHIN(TEMP_TELEMETRY_SAMPLES, 2, 255)
+    #error "TEMP_TELEMETRY_SAMPLES must be between 2 and 255."
+  #endif
 #endif
 
 /**
@@ -1479,8 +1619,12 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
 /**
  * Chamber Heating Options - PID vs Limit Switching
  */
-#if BOTH(PIDTEMPCHAMBER, CHAMBER_LIMIT_SWITCHING)
+#if BOTH(PIDTEMPCHAMBER, MPCTEMPCHAMBER)
+  #error "Only enable PIDTEMPCHAMBER or MPCTEMPCHAMBER, but not both."
+#elif BOTH(PIDTEMPCHAMBER, CHAMBER_LIMIT_SWITCHING)
   #error "To use CHAMBER_LIMIT_SWITCHING you must disable PIDTEMPCHAMBER."
+#elif BOTH(MPCTEMPCHAMBER, CHAMBER_LIMIT_SWITCHING)
+  #error "To use CHAMBER_LIMIT_SWITCHING you must disable MPCTEMPCHAMBER."
 #endif
 
 /**
@@ -3537,6 +3681,8 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
     #error "POWER_LOSS_RECOVER_ZHOME is not needed on a machine that homes to ZMAX."
   #elif BOTH(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MIN && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
+  #elif ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_BLOCKS, 1, 64)
+    #error "POWER_LOSS_JOURNAL_BLOCKS must be between 1 and 64."
   #endif
 #endif
 
@@ -3795,6 +3941,19 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
   #error "ADC_BUTTON_DEBOUNCE_DELAY must be greater than 16."
 #endif
 
+/**
+ * ADC Scan Sampling requirements
+ */
+#if ENABLED(ADC_SCAN_SAMPLING)
+  #ifndef HAL_ADC_DMA_SCAN
+    #error "ADC_SCAN_SAMPLING requires a HAL that samples all ADC channels by DMA scan (STM32F1, SAMD51, LINUX)."
+  #elif defined(HAL_ADC_FILTERED)
+    #error "ADC_SCAN_SAMPLING is not compatible with HAL_ADC_FILTERED."
+  #elif HAS_ADC_BUTTONS
+    #error "ADC_SCAN_SAMPLING is not compatible with ADC_KEYPAD."
+  #endif
+#endif
+
 /**
  * Check to make sure MONITOR_DRIVER_STATUS isn't enabled
  * on boards where TMC drivers share the SPI bus with SD.
@@ -3840,6 +3999,15 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
 #if BOTH(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#if ENABLED(MEATPACK_DICTIONARY)
+  #if !HAS_MEATPACK
+    #error "MEATPACK_DICTIONARY requires MEATPACK_ON_SERIAL_PORT_*."
+  #elif !WITHIN(MEATPACK_DICT_SIZE, 1, 64)
+    #error "MEATPACK_DICT_SIZE must be between 1 and 64."
+  #elif !WITHIN(MEATPACK_DICT_TOKEN_LEN, 1, 16)
+    #error "MEATPACK_DICT_TOKEN_LEN must be between 1 and 16."
+  #endif
+#endif
 
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
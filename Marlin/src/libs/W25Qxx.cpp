@@ -170,7 +170,21 @@ void W25QXXFlash::SPI_FLASH_WaitForWriteEnd() {
   SPI_FLASH_CS_H();
 }
 
-void W25QXXFlash::SPI_FLASH_SectorErase(uint32_t SectorAddr) {
+/**
+ * @brief  Check the Write In Progress (WIP) flag once, for callers
+ *         that don't want to wait for an erase or write to finish.
+ *
+ * @return true while the FLASH is busy with a write cycle
+ */
+bool W25QXXFlash::SPI_FLASH_Busy() {
+  SPI_FLASH_CS_L();
+  spi_flash_Send(W25X_ReadStatusReg);
+  const bool busy = spi_flash_Rec() & WIP_Flag;
+  SPI_FLASH_CS_H();
+  return busy;
+}
+
+void W25QXXFlash::SPI_FLASH_SectorErase(uint32_t SectorAddr, const bool wait/*=true*/) {
   // Send write enable instruction
   SPI_FLASH_WriteEnable();
 
@@ -189,7 +203,7 @@ void W25QXXFlash::SPI_FLASH_SectorErase(uint32_t SectorAddr) {
 
   SPI_FLASH_CS_H();
   // Wait the end of Flash writing
-  SPI_FLASH_WaitForWriteEnd();
+  if (wait) SPI_FLASH_WaitForWriteEnd();
 }
 
 void W25QXXFlash::SPI_FLASH_BlockErase(uint32_t BlockAddr) {
@@ -242,10 +256,12 @@ void W25QXXFlash::SPI_FLASH_BulkErase() {
 *                  - WriteAddr : FLASH's internal address to write to.
 *                  - NumByteToWrite : number of bytes to write to the FLASH,
 *                    must be equal or less than "SPI_FLASH_PageSize" value.
+*                  - wait : false to return without waiting for the write cycle
+*                    to end. Check SPI_FLASH_Busy() before the next operation.
 * Output         : None
 * Return         : None
 *******************************************************************************/
-void W25QXXFlash::SPI_FLASH_PageWrite(uint8_t *pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite) {
+void W25QXXFlash::SPI_FLASH_PageWrite(uint8_t *pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite, const bool wait/*=true*/) {
   // Enable the write access to the FLASH
   SPI_FLASH_WriteEnable();
 
@@ -274,7 +290,7 @@ void W25QXXFlash::SPI_FLASH_PageWrite(uint8_t *pBuffer, uint32_t WriteAddr, uint
   SPI_FLASH_CS_H();
 
   // Wait the end of Flash writing
-  SPI_FLASH_WaitForWriteEnd();
+  if (wait) SPI_FLASH_WaitForWriteEnd();
 }
 
 /*******************************************************************************
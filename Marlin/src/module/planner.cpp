@@ -182,6 +182,9 @@ float Planner::mm_per_step[DISTINCT_AXES];      // (mm) Millimeters per step
 #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
   float Planner::volumetric_extruder_limit[EXTRUDERS],          // max mm^3/sec the extruder is able to handle
         Planner::volumetric_extruder_feedrate_limit[EXTRUDERS]; // pre calculated extruder feedrate limit based on volumetric_extruder_limit; pre-calculated to reduce computation in the planner
+  #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC)
+    float Planner::dynamic_volumetric_limit[HOTENDS]; // = { 0 }
+  #endif
 #endif
 
 #if HAS_LEVELING
@@ -1425,6 +1428,8 @@ void Planner::check_axes_activity() {
 
   TERN_(AUTOTEMP, autotemp_task());
 
+  TERN_(VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC, dynamic_volumetric_task());
+
   #if ENABLED(BARICUDA)
     TERN_(HAS_HEATER_1, hal.set_pwm_duty(pin_t(HEATER_1_PIN), tail_valve_pressure));
     TERN_(HAS_HEATER_2, hal.set_pwm_duty(pin_t(HEATER_2_PIN), tail_e_to_p_pressure));
@@ -1497,6 +1502,92 @@ void Planner::check_axes_activity() {
 
 #endif
 
+#if EITHER(HOTEND_FEEDFORWARD, VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC)
+
+  /**
+   * Get the volumetric flow (mm³/s) a hotend will extrude over the next lookahead_ms.
+   * The planned E steps already include the flow and volumetric multipliers, so the
+   * filament length is simply scaled by the filament cross-section. Only printing moves
+   * are counted, so retract and recover don't look like heavy flow.
+   * With 'peak' get the highest flow of any one move instead of the average.
+   */
+  float Planner::upcoming_flow(const uint8_t hotend, const millis_t lookahead_ms, const bool peak/*=false*/) {
+    float time = 0, volume = 0, peak_flow = 0;
+    for (uint8_t b = block_buffer_tail; b != block_buffer_head && time * 1000 < lookahead_ms; b = next_block_index(b)) {
+      block_t * const block = &block_buffer[b];
+      if (!block->is_move() || block->nominal_speed <= 0) continue;
+      const float block_time = block->millimeters / block->nominal_speed;
+      time += block_time;
+      #if HOTENDS > 1
+        if (block->extruder != hotend) continue;
+      #else
+        UNUSED(hotend);
+      #endif
+      if (block->steps.e && !TEST(block->direction_bits, E_AXIS)
+        && (NUM_AXIS_GANG(block->steps.x, || block->steps.y, || block->steps.z, || block->steps.i, || block->steps.j, || block->steps.k))
+      ) {
+        const float block_volume = block->steps.e * mm_per_step[E_AXIS_N(block->extruder)] * filament_area(block->extruder);
+        volume += block_volume;
+        NOLESS(peak_flow, block_volume / block_time);
+      }
+    }
+    if (peak) return peak_flow;
+    return time > 0 ? volume / time : 0;
+  }
+
+#endif
+
+#if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC)
+
+  /**
+   * Lower the volumetric limit of a hotend that is over capacity, shown by the
+   * temperature falling behind or the heater running flat out while printing.
+   * Raise the limit gradually once it catches up, and drop it when it no longer
+   * restricts anything. The limit applies to moves planned from then on.
+   * The fastest planned move is compared with the limit, since that's what it slows.
+   * A hotend is given DYNAMIC_LIMIT_TARGET_GRACE to reach a new target before its
+   * temperature counts against it.
+   */
+  void Planner::dynamic_volumetric_task() {
+    static millis_t next_check_ms = 0;
+    static celsius_t last_target[HOTENDS] = { 0 };
+    static millis_t grace_ms[HOTENDS] = { 0 };
+    const millis_t ms = millis();
+    if (PENDING(ms, next_check_ms)) return;
+    next_check_ms = ms + 500UL;
+    constexpr float dt = 0.5f;
+
+    HOTEND_LOOP() {
+      float &lim = dynamic_volumetric_limit[e];
+      const celsius_t target = thermalManager.degTargetHotend(e);
+      if (target != last_target[e]) {
+        last_target[e] = target;
+        grace_ms[e] = ms + SEC_TO_MS(DYNAMIC_LIMIT_TARGET_GRACE);
+      }
+      if (!target) { lim = 0; continue; }
+      if (PENDING(ms, grace_ms[e])) continue;
+
+      const float deficit = target - thermalManager.degHotend(e),
+                  flow = upcoming_flow(e, 1000, true);
+      const bool flat_out = thermalManager.getHeaterPower((heater_id_t)e)
+                            >= (TERN(MPCTEMP, MPC_MAX, PID_MAX) >> 1) * (DYNAMIC_LIMIT_MAX_DUTY) / 100;
+
+      if (flow > 0 && (deficit > DYNAMIC_LIMIT_MAX_DEFICIT || (flat_out && deficit > 0))) {
+        // Over capacity. Plan new moves slower than the flow asked for now.
+        lim = (lim ? _MIN(lim, flow) : flow) * (1.0f - (DYNAMIC_LIMIT_DECREASE) * 0.01f * dt);
+        NOLESS(lim, DYNAMIC_LIMIT_MIN_FLOW);
+      }
+      else if (lim) {
+        // Caught up. Give the flow back a little at a time.
+        lim *= 1.0f + (DYNAMIC_LIMIT_RECOVER) * 0.01f * dt;
+        const float &vlim = volumetric_extruder_limit[e];
+        if (lim >= (vlim ? vlim : settings.max_feedrate_mm_s[E_AXIS_N(e)] * filament_area(e))) lim = 0;
+      }
+    }
+  }
+
+#endif
+
 #if DISABLED(NO_VOLUMETRICS)
 
   /**
@@ -2366,8 +2457,18 @@ bool Planner::_populate_block(
       if (cs > max_fr) NOMORE(speed_factor, max_fr / cs); //respect max feedrate on any movement (doesn't matter if E axes only or not)
 
       #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
-        const feedRate_t max_vfr = volumetric_extruder_feedrate_limit[extruder]
-                                   * TERN(HAS_MIXER_SYNC_CHANNEL, MIXING_STEPPERS, 1);
+        feedRate_t max_vfr = volumetric_extruder_feedrate_limit[extruder];
+
+        #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC)
+          // Slow down while the hotend can't keep up
+          const float dyn_lim = dynamic_volumetric_limit[TERN(HAS_MULTI_HOTEND, extruder, 0)];
+          if (dyn_lim) {
+            const feedRate_t dyn_vfr = dyn_lim / filament_area(extruder);
+            if (!max_vfr || dyn_vfr < max_vfr) max_vfr = dyn_vfr;
+          }
+        #endif
+
+        max_vfr *= TERN(HAS_MIXER_SYNC_CHANNEL, MIXING_STEPPERS, 1);
 
         // TODO: Doesn't work properly for joined segments. Set MIN_STEPS_PER_SEGMENT 1 as workaround.
 
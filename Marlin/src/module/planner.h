@@ -423,6 +423,9 @@ class Planner {
     #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
       static float volumetric_extruder_limit[EXTRUDERS],          // Maximum mm^3/sec the extruder can handle
                    volumetric_extruder_feedrate_limit[EXTRUDERS]; // Feedrate limit (mm/s) calculated from volume limit
+      #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC)
+        static float dynamic_volumetric_limit[HOTENDS];           // Limit (mm^3/sec) while the hotend can't keep up. 0 when not limiting.
+      #endif
     #endif
 
     static planner_settings_t settings;
@@ -626,6 +629,13 @@ class Planner {
 
     #endif
 
+    #if HAS_EXTRUDERS
+      // Cross-sectional area of the filament loaded in an extruder (mm²)
+      FORCE_INLINE static float filament_area(const uint8_t e) {
+        return CIRCLE_AREA(TERN(NO_VOLUMETRICS, float(DEFAULT_NOMINAL_FILAMENT_DIA), filament_size[e]) * 0.5f);
+      }
+    #endif
+
     #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT)
       FORCE_INLINE static void set_volumetric_extruder_limit(const uint8_t e, const_float_t v) {
         volumetric_extruder_limit[e] = v;
@@ -974,6 +984,14 @@ class Planner {
       static void clear_block_buffer_runtime();
     #endif
 
+    #if EITHER(HOTEND_FEEDFORWARD, VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC)
+      static float upcoming_flow(const uint8_t hotend, const millis_t lookahead_ms, const bool peak=false);
+    #endif
+
+    #if ENABLED(VOLUMETRIC_EXTRUDER_LIMIT_DYNAMIC)
+      static void dynamic_volumetric_task();
+    #endif
+
     #if ENABLED(AUTOTEMP)
       static celsius_t autotemp_min, autotemp_max;
       static float autotemp_factor;
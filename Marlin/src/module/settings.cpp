@@ -45,6 +45,12 @@
 
 #include "settings.h"
 
+#if ENABLED(EEPROM_SECTIONS)
+  // Change only if the section format changes. Otherwise bump a section version below.
+  #undef EEPROM_VERSION
+  #define EEPROM_VERSION "S01"
+#endif
+
 #include "endstops.h"
 #include "planner.h"
 #include "stepper.h"
@@ -173,6 +179,26 @@
 
 #pragma pack(push, 1) // No padding between variables
 
+#if ENABLED(EEPROM_SECTIONS)
+
+  /**
+   * With EEPROM_SECTIONS the settings are stored as a chain of sections, each with
+   * its own header. On load each section is looked up by its id and only used if
+   * its version, size and CRC check out. Sections that fail keep their defaults.
+   */
+  typedef struct {
+    uint8_t id, version;
+    uint16_t size, crc;     // Size of the data that follows and its CRC
+  } settings_section_t;
+
+  #define EEPROM_SECTION_FIELD(S) settings_section_t section_##S;
+
+#else
+
+  #define EEPROM_SECTION_FIELD(S)
+
+#endif
+
 #if HAS_ETHERNET
   void ETH0_report();
   void MAC_report();
@@ -209,6 +235,8 @@ typedef struct SettingsDataStruct {
   #endif
   uint16_t  crc;                                        // Data Checksum
 
+  EEPROM_SECTION_FIELD(motion)
+
   //
   // DISTINCT_E_FACTORS
   //
@@ -240,6 +268,8 @@ typedef struct SettingsDataStruct {
   bool runout_sensor_enabled;                           // M412 S
   float runout_distance_mm;                             // M412 D
 
+  EEPROM_SECTION_FIELD(leveling)
+
   //
   // ENABLE_LEVELING_FADE_HEIGHT
   //
@@ -253,12 +283,16 @@ typedef struct SettingsDataStruct {
   float mbl_z_values[TERN(MESH_BED_LEVELING, GRID_MAX_POINTS_X, 3)]   // bedlevel.z_values
                     [TERN(MESH_BED_LEVELING, GRID_MAX_POINTS_Y, 3)];
 
+  EEPROM_SECTION_FIELD(probe)
+
   //
   // HAS_BED_PROBE
   //
 
   xyz_pos_t probe_offset;
 
+  EEPROM_SECTION_FIELD(abl)
+
   //
   // ABL_PLANAR
   //
@@ -290,6 +324,8 @@ typedef struct SettingsDataStruct {
   bool planner_leveling_active;                         // M420 S  planner.leveling_active
   int8_t ubl_storage_slot;                              // bedlevel.storage_slot
 
+  EEPROM_SECTION_FIELD(machine)
+
   //
   // SERVO_ANGLES
   //
@@ -354,6 +390,8 @@ typedef struct SettingsDataStruct {
     #endif
   #endif
 
+  EEPROM_SECTION_FIELD(preheat)
+
   //
   // Material Presets
   //
@@ -361,6 +399,8 @@ typedef struct SettingsDataStruct {
     preheat_t ui_material_preset[PREHEAT_COUNT];        // M145 S0 H B F
   #endif
 
+  EEPROM_SECTION_FIELD(pid)
+
   //
   // PIDTEMP
   //
@@ -384,6 +424,8 @@ typedef struct SettingsDataStruct {
     user_thermistor_t user_thermistor[USER_THERMISTORS]; // M305 P0 R4700 T100000 B3950
   #endif
 
+  EEPROM_SECTION_FIELD(ui)
+
   //
   // Power monitor
   //
@@ -418,6 +460,8 @@ typedef struct SettingsDataStruct {
   //
   bool recovery_enabled;                                // M413 S
 
+  EEPROM_SECTION_FIELD(extruder)
+
   //
   // FWRETRACT
   //
@@ -431,6 +475,8 @@ typedef struct SettingsDataStruct {
   float planner_filament_size[EXTRUDERS];               // M200 T D  planner.filament_size[]
   float planner_volumetric_extruder_limit[EXTRUDERS];   // M200 T L  planner.volumetric_extruder_limit[]
 
+  EEPROM_SECTION_FIELD(drivers)
+
   //
   // HAS_TRINAMIC_CONFIG
   //
@@ -460,6 +506,8 @@ typedef struct SettingsDataStruct {
   #endif
   uint32_t motor_current_setting[MOTOR_CURRENT_COUNT];  // M907 X Z E ...
 
+  EEPROM_SECTION_FIELD(workspace)
+
   //
   // CNC_COORDINATE_SYSTEMS
   //
@@ -470,6 +518,8 @@ typedef struct SettingsDataStruct {
   //
   skew_factor_t planner_skew_factor;                    // M852 I J K  planner.skew_factor
 
+  EEPROM_SECTION_FIELD(features)
+
   //
   // ADVANCED_PAUSE_FEATURE
   //
@@ -566,12 +616,22 @@ typedef struct SettingsDataStruct {
     uint8_t ui_language;                                // M414 S
   #endif
 
+  EEPROM_SECTION_FIELD(mpc)
+
   //
   // Model predictive control
   //
   #if ENABLED(MPCTEMP)
     MPC_t mpc_constants[HOTENDS];                       // M306
   #endif
+  #if ENABLED(MPCTEMPBED)
+    MPC_t bed_mpc_constants;                            // M306 E-1
+  #endif
+  #if ENABLED(MPCTEMPCHAMBER)
+    MPC_t chamber_mpc_constants;                        // M306 E-2
+  #endif
+
+  EEPROM_SECTION_FIELD(end)
 
 } SettingsData;
 
@@ -714,6 +774,121 @@ void MarlinSettings::postprocess() {
 
   const char version[4] = EEPROM_VERSION;
 
+  #if ENABLED(EEPROM_SECTIONS)
+
+    // Sections in storage order. Add new sections anywhere with a new id.
+    enum SettingsSection : uint8_t {
+      SECTION_MOTION, SECTION_LEVELING, SECTION_PROBE, SECTION_ABL, SECTION_MACHINE, SECTION_PREHEAT, SECTION_PID,
+      SECTION_UI, SECTION_EXTRUDER, SECTION_DRIVERS, SECTION_WORKSPACE, SECTION_FEATURES, SECTION_MPC,
+      SECTION_END, NO_SECTION = 0xFF
+    };
+
+    // Bump a section's version when its data changes. Only that section resets to defaults.
+    static const uint8_t section_version[SECTION_END] PROGMEM = {
+      1, // MOTION     E factors, planner, home and hotend offsets, runout
+      1, // LEVELING   Fade height, mesh bed leveling
+      1, // PROBE      Probe offsets
+      1, // ABL        Planar matrix, bilinear mesh, X twist, UBL state
+      1, // MACHINE    Servos, thermal compensation, BLTouch, kinematics, endstop and stepper alignment
+      1, // PREHEAT    Material presets
+      1, // PID        Hotend, bed and chamber PID, user thermistors
+      1, // UI         Power monitor, LCD contrast, brightness and sleep, controller fan, power-loss
+      1, // EXTRUDER   Firmware retraction, volumetric
+      1, // DRIVERS    TMC drivers, linear advance, motor currents
+      1, // WORKSPACE  Coordinate systems, skew
+      1, // FEATURES   Filament change, tool change, backlash, user interfaces and everything else
+      1  // MPC        Model predictive control
+    };
+
+    #define EEPROM_SECTION_WRITE(S) section_write(SECTION_##S)
+    #define EEPROM_SECTION_READ(S)  section_read(SECTION_##S)
+
+    static_assert(SECTION_END <= 32, "Too many settings sections for section_ok.");
+
+    uint8_t MarlinSettings::section_id = NO_SECTION;
+    int MarlinSettings::section_index;
+    uint16_t MarlinSettings::section_size, MarlinSettings::section_crc;
+    uint32_t MarlinSettings::section_ok;
+    bool MarlinSettings::section_skip, MarlinSettings::section_forced;
+
+    uint8_t MarlinSettings::section_count(uint32_t bits) {
+      uint8_t n = 0;
+      for (; bits; bits >>= 1) n += bits & 1;
+      return n;
+    }
+
+    // Finish the section being written with its header
+    void MarlinSettings::section_write_end() {
+      if (section_id == NO_SECTION) return;
+      const settings_section_t hdr = {
+        section_id, section_id < SECTION_END ? pgm_read_byte(&section_version[section_id]) : uint8_t(0),
+        uint16_t(eeprom_index - section_index - sizeof(settings_section_t)), working_crc
+      };
+      persistentStore.write_data(section_index, (const uint8_t *)&hdr, sizeof(hdr));
+      section_id = NO_SECTION;
+    }
+
+    // Start writing a section, leaving room for its header
+    void MarlinSettings::section_write(const uint8_t id) {
+      section_write_end();
+      section_id = id;
+      section_index = eeprom_index;
+      eeprom_index += sizeof(settings_section_t);
+      working_crc = 0;
+    }
+
+    // Walk the chain to find a section. Return the position of its data or -1.
+    static int section_find(const uint8_t id, settings_section_t &hdr) {
+      int pos = EEPROM_OFFSET + offsetof(SettingsData, section_motion);
+      LOOP_L_N(i, 64) {
+        if (pos + int(sizeof(hdr)) > int(persistentStore.capacity())) break;
+        persistentStore.read_data(pos, (uint8_t *)&hdr, sizeof(hdr));
+        pos += sizeof(hdr);
+        if (hdr.id == id) return pos;
+        if (hdr.id >= SECTION_END) break;
+        pos += hdr.size;
+      }
+      return -1;
+    }
+
+    // Finish reading a section. While validating note whether it checked out.
+    void MarlinSettings::section_read_end() {
+      if (section_id == NO_SECTION) return;
+      if (validating && !section_skip && eeprom_index - section_index == section_size && working_crc == section_crc)
+        SBI(section_ok, section_id);
+      if (section_forced) validating = section_forced = false;
+      section_skip = false;
+      section_id = NO_SECTION;
+    }
+
+    /**
+     * Start reading a section from wherever it is stored. A section that isn't stored,
+     * has another version, or failed validation is skipped: its reads return zeros and
+     * nothing is applied, so its settings keep their defaults.
+     */
+    void MarlinSettings::section_read(const uint8_t id) {
+      section_read_end();
+      section_id = id;
+      settings_section_t hdr;
+      const int pos = section_find(id, hdr);
+      if (pos >= 0) {
+        eeprom_index = pos;
+        section_size = hdr.size;
+        section_crc = hdr.crc;
+      }
+      section_index = eeprom_index;
+      working_crc = 0;
+      section_skip = pos < 0 || hdr.version != pgm_read_byte(&section_version[id]) || !(validating || TEST(section_ok, id));
+      if (section_skip && !validating) validating = section_forced = true;
+    }
+
+  #else
+
+    #define EEPROM_SECTION_WRITE(S) NOOP
+    #define EEPROM_SECTION_READ(S)  NOOP
+
+  #endif
+
   #if ENABLED(EEPROM_INIT_NOW)
     constexpr uint32_t strhash32(const char *s, const uint32_t h=0) {
       return *s ? strhash32(s + 1, ((h + *s) << (*s & 3)) ^ *s) : h;
@@ -759,6 +934,8 @@ void MarlinSettings::postprocess() {
 
     working_crc = 0; // clear before first "real data"
 
+    EEPROM_SECTION_WRITE(MOTION);
+
     const uint8_t e_factors = DISTINCT_AXES - (NUM_AXES);
     _FIELD_TEST(e_factors);
     EEPROM_WRITE(e_factors);
@@ -831,6 +1008,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(runout_distance_mm);
     }
 
+    EEPROM_SECTION_WRITE(LEVELING);
+
     //
     // Global Leveling
     //
@@ -866,6 +1045,8 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    EEPROM_SECTION_WRITE(PROBE);
+
     //
     // Probe XYZ Offsets
     //
@@ -879,6 +1060,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(zpo);
     }
 
+    EEPROM_SECTION_WRITE(ABL);
+
     //
     // Planar Bed Leveling matrix
     //
@@ -944,6 +1127,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(storage_slot);
     }
 
+    EEPROM_SECTION_WRITE(MACHINE);
+
     //
     // Servo Angles
     //
@@ -1039,6 +1224,8 @@ void MarlinSettings::postprocess() {
       #endif
     #endif
 
+    EEPROM_SECTION_WRITE(PREHEAT);
+
     //
     // LCD Preheat settings
     //
@@ -1047,6 +1234,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(ui.material_preset);
     #endif
 
+    EEPROM_SECTION_WRITE(PID);
+
     //
     // PIDTEMP
     //
@@ -1123,6 +1312,8 @@ void MarlinSettings::postprocess() {
     }
     #endif
 
+    EEPROM_SECTION_WRITE(UI);
+
     //
     // Power monitor
     //
@@ -1185,6 +1376,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(recovery_enabled);
     }
 
+    EEPROM_SECTION_WRITE(EXTRUDER);
+
     //
     // Firmware Retraction
     //
@@ -1230,6 +1423,8 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    EEPROM_SECTION_WRITE(DRIVERS);
+
     //
     // TMC Configuration
     //
@@ -1419,6 +1614,8 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    EEPROM_SECTION_WRITE(WORKSPACE);
+
     //
     // CNC Coordinate Systems
     //
@@ -1436,6 +1633,8 @@ void MarlinSettings::postprocess() {
     _FIELD_TEST(planner_skew_factor);
     EEPROM_WRITE(planner.skew_factor);
 
+    EEPROM_SECTION_WRITE(FEATURES);
+
     //
     // Advanced Pause filament load & unload lengths
     //
@@ -1586,6 +1785,8 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(ui.language);
     #endif
 
+    EEPROM_SECTION_WRITE(MPC);
+
     //
     // Model predictive control
     //
@@ -1593,13 +1794,20 @@ void MarlinSettings::postprocess() {
       HOTEND_LOOP()
         EEPROM_WRITE(thermalManager.temp_hotend[e].constants);
     #endif
+    TERN_(MPCTEMPBED, EEPROM_WRITE(thermalManager.temp_bed.constants));
+    TERN_(MPCTEMPCHAMBER, EEPROM_WRITE(thermalManager.temp_chamber.constants));
+
+    #if ENABLED(EEPROM_SECTIONS)
+      EEPROM_SECTION_WRITE(END);  // Terminate the chain
+      section_write_end();
+    #endif
 
     //
     // Report final CRC and Data Size
     //
     if (!eeprom_error) {
       const uint16_t eeprom_size = eeprom_index - (EEPROM_OFFSET),
-                     final_crc = working_crc;
+                     final_crc = TERN(EEPROM_SECTIONS, 0, working_crc); // Sections have their own CRC
 
       // Write the EEPROM header
       eeprom_index = EEPROM_OFFSET;
@@ -1611,7 +1819,11 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(final_crc);
 
       // Report storage size
-      DEBUG_ECHO_MSG("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)final_crc, ")");
+      #if ENABLED(EEPROM_SECTIONS)
+        DEBUG_ECHO_MSG("Settings Stored (", eeprom_size, " bytes; ", int(SECTION_END), " sections)");
+      #else
+        DEBUG_ECHO_MSG("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)final_crc, ")");
+      #endif
 
       eeprom_error |= size_error(eeprom_size);
     }
@@ -1672,6 +1884,9 @@ void MarlinSettings::postprocess() {
       float dummyf = 0;
       working_crc = 0;  // Init to 0. Accumulated by EEPROM_READ
 
+      TERN_(EEPROM_SECTIONS, if (validating) section_ok = 0);
+      EEPROM_SECTION_READ(MOTION);
+
       _FIELD_TEST(e_factors);
 
       // Number of e_factors may change
@@ -1764,6 +1979,8 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      EEPROM_SECTION_READ(LEVELING);
+
       //
       // Global Leveling
       //
@@ -1795,6 +2012,8 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      EEPROM_SECTION_READ(PROBE);
+
       //
       // Probe Z Offset
       //
@@ -1808,6 +2027,8 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(zpo);
       }
 
+      EEPROM_SECTION_READ(ABL);
+
       //
       // Planar Bed Leveling matrix
       //
@@ -1869,6 +2090,8 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(ubl_storage_slot);
       }
 
+      EEPROM_SECTION_READ(MACHINE);
+
       //
       // SERVO_ANGLES
       //
@@ -1972,6 +2195,8 @@ void MarlinSettings::postprocess() {
         #endif
       #endif
 
+      EEPROM_SECTION_READ(PREHEAT);
+
       //
       // LCD Preheat settings
       //
@@ -1980,6 +2205,8 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(ui.material_preset);
       #endif
 
+      EEPROM_SECTION_READ(PID);
+
       //
       // Hotend PID
       //
@@ -2057,6 +2284,8 @@ void MarlinSettings::postprocess() {
       }
       #endif
 
+      EEPROM_SECTION_READ(UI);
+
       //
       // Power monitor
       //
@@ -2116,6 +2345,8 @@ void MarlinSettings::postprocess() {
         TERN_(POWER_LOSS_RECOVERY, if (!validating) recovery.enabled = recovery_enabled);
       }
 
+      EEPROM_SECTION_READ(EXTRUDER);
+
       //
       // Firmware Retraction
       //
@@ -2158,6 +2389,8 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      EEPROM_SECTION_READ(DRIVERS);
+
       //
       // TMC Stepper Settings
       //
@@ -2363,6 +2596,8 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      EEPROM_SECTION_READ(WORKSPACE);
+
       //
       // CNC Coordinate System
       //
@@ -2395,6 +2630,8 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      EEPROM_SECTION_READ(FEATURES);
+
       //
       // Advanced Pause filament load & unload lengths
       //
@@ -2546,6 +2783,8 @@ void MarlinSettings::postprocess() {
       }
       #endif
 
+      EEPROM_SECTION_READ(MPC);
+
       //
       // Model predictive control
       //
@@ -2555,28 +2794,53 @@ void MarlinSettings::postprocess() {
           EEPROM_READ(thermalManager.temp_hotend[e].constants);
       }
       #endif
+      TERN_(MPCTEMPBED, EEPROM_READ(thermalManager.temp_bed.constants));
+      TERN_(MPCTEMPCHAMBER, EEPROM_READ(thermalManager.temp_chamber.constants));
 
-      //
-      // Validate Final Size and CRC
-      //
-      eeprom_error = size_error(eeprom_index - (EEPROM_OFFSET));
-      if (eeprom_error) {
-        DEBUG_ECHO_MSG("Index: ", eeprom_index - (EEPROM_OFFSET), " Size: ", datasize());
-        IF_DISABLED(EEPROM_AUTO_INIT, ui.eeprom_alert_index());
-      }
-      else if (working_crc != stored_crc) {
-        eeprom_error = true;
-        DEBUG_ERROR_MSG("EEPROM CRC mismatch - (stored) ", stored_crc, " != ", working_crc, " (calculated)!");
-        TERN_(DWIN_LCD_PROUI, LCD_MESSAGE(MSG_ERR_EEPROM_CRC));
-        TERN_(HOST_EEPROM_CHITCHAT, hostui.notify(GET_TEXT_F(MSG_ERR_EEPROM_CRC)));
-        IF_DISABLED(EEPROM_AUTO_INIT, ui.eeprom_alert_crc());
-      }
-      else if (!validating) {
-        DEBUG_ECHO_START();
-        DEBUG_ECHO(version);
-        DEBUG_ECHOLNPGM(" stored settings retrieved (", eeprom_index - (EEPROM_OFFSET), " bytes; crc ", (uint32_t)working_crc, ")");
-        TERN_(HOST_EEPROM_CHITCHAT, hostui.notify(F("Stored settings retrieved")));
-      }
+      #if ENABLED(EEPROM_SECTIONS)
+
+        //
+        // Validate the sections
+        //
+        section_read_end();
+        if (!section_ok) {
+          eeprom_error = true;
+          DEBUG_ERROR_MSG("EEPROM has no valid settings sections!");
+          TERN_(HOST_EEPROM_CHITCHAT, hostui.notify(GET_TEXT_F(MSG_ERR_EEPROM_CRC)));
+          IF_DISABLED(EEPROM_AUTO_INIT, ui.eeprom_alert_crc());
+        }
+        else if (!validating) {
+          DEBUG_ECHO_START();
+          DEBUG_ECHO(version);
+          DEBUG_ECHOLNPGM(" stored settings retrieved (", section_count(section_ok), " of ", int(SECTION_END), " sections)");
+          TERN_(HOST_EEPROM_CHITCHAT, hostui.notify(F("Stored settings retrieved")));
+        }
+
+      #else
+
+        //
+        // Validate Final Size and CRC
+        //
+        eeprom_error = size_error(eeprom_index - (EEPROM_OFFSET));
+        if (eeprom_error) {
+          DEBUG_ECHO_MSG("Index: ", eeprom_index - (EEPROM_OFFSET), " Size: ", datasize());
+          IF_DISABLED(EEPROM_AUTO_INIT, ui.eeprom_alert_index());
+        }
+        else if (working_crc != stored_crc) {
+          eeprom_error = true;
+          DEBUG_ERROR_MSG("EEPROM CRC mismatch - (stored) ", stored_crc, " != ", working_crc, " (calculated)!");
+          TERN_(DWIN_LCD_PROUI, LCD_MESSAGE(MSG_ERR_EEPROM_CRC));
+          TERN_(HOST_EEPROM_CHITCHAT, hostui.notify(GET_TEXT_F(MSG_ERR_EEPROM_CRC)));
+          IF_DISABLED(EEPROM_AUTO_INIT, ui.eeprom_alert_crc());
+        }
+        else if (!validating) {
+          DEBUG_ECHO_START();
+          DEBUG_ECHO(version);
+          DEBUG_ECHOLNPGM(" stored settings retrieved (", eeprom_index - (EEPROM_OFFSET), " bytes; crc ", (uint32_t)working_crc, ")");
+          TERN_(HOST_EEPROM_CHITCHAT, hostui.notify(F("Stored settings retrieved")));
+        }
+
+      #endif
 
       if (!validating && !eeprom_error) postprocess();
 
@@ -2601,8 +2865,19 @@ void MarlinSettings::postprocess() {
           }
 
           if (bedlevel.storage_slot >= 0) {
-            load_mesh(bedlevel.storage_slot);
-            DEBUG_ECHOLNPGM("Mesh ", bedlevel.storage_slot, " loaded from storage.");
+            #if ENABLED(FAST_BOOT)
+              mesh_pending = (marlin_state == MF_INITIALIZING); // Leave it for idle() during setup()
+              if (mesh_pending) {
+                // Level with the mesh only once it's there
+                mesh_pending_active = planner.leveling_active;
+                planner.leveling_active = false;
+              }
+              else
+            #endif
+              {
+                load_mesh(bedlevel.storage_slot);
+                DEBUG_ECHOLNPGM("Mesh ", bedlevel.storage_slot, " loaded from storage.");
+              }
           }
           else {
             bedlevel.reset();
@@ -2643,6 +2918,14 @@ void MarlinSettings::postprocess() {
 
   bool MarlinSettings::load() {
     if (validate()) {
+      #if ENABLED(EEPROM_SECTIONS)
+        // Start from defaults if some sections are missing, outdated or corrupt
+        const uint8_t good = section_count(section_ok);
+        if (good < SECTION_END) {
+          reset();
+          DEBUG_ECHO_MSG("EEPROM ", int(SECTION_END - good), " settings sections reset to defaults.");
+        }
+      #endif
       const bool success = _load();
       TERN_(EXTENSIBLE_UI, ExtUI::onSettingsLoaded(success));
       return success;
@@ -2720,6 +3003,21 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    #if BOTH(AUTO_BED_LEVELING_UBL, FAST_BOOT)
+
+      bool MarlinSettings::mesh_pending, // = false
+           MarlinSettings::mesh_pending_active;
+
+      void MarlinSettings::load_pending_mesh() {
+        if (!mesh_pending) return;
+        mesh_pending = false;
+        load_mesh(bedlevel.storage_slot);
+        DEBUG_ECHOLNPGM("Mesh ", bedlevel.storage_slot, " loaded from storage.");
+        if (mesh_pending_active) set_bed_leveling_enabled(true); // Also updates current_position
+      }
+
+    #endif
+
     void MarlinSettings::load_mesh(const int8_t slot, void * const into/*=nullptr*/) {
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
@@ -3308,6 +3606,19 @@ void MarlinSettings::reset() {
     }
   #endif
 
+  #if ENABLED(MPCTEMPBED)
+    thermalManager.temp_bed.constants = {
+      MPC_BED_HEATER_POWER, MPC_BED_BLOCK_HEAT_CAPACITY, MPC_BED_SENSOR_RESPONSIVENESS, MPC_BED_AMBIENT_XFER_COEFF
+      OPTARG(MPC_INCLUDE_FAN, 0.0f), 0.0f
+    };
+  #endif
+  #if ENABLED(MPCTEMPCHAMBER)
+    thermalManager.temp_chamber.constants = {
+      MPC_CHAMBER_HEATER_POWER, MPC_CHAMBER_BLOCK_HEAT_CAPACITY, MPC_CHAMBER_SENSOR_RESPONSIVENESS, MPC_CHAMBER_AMBIENT_XFER_COEFF
+      OPTARG(MPC_INCLUDE_FAN, 0.0f), 0.0f
+    };
+  #endif
+
   postprocess();
 
   #if EITHER(EEPROM_CHITCHAT, DEBUG_LEVELING_FEATURE)
@@ -3603,7 +3914,7 @@ void MarlinSettings::reset() {
     //
     // Model predictive control
     //
-    TERN_(MPCTEMP, gcode.M306_report(forReplay));
+    TERN_(HAS_MPC, gcode.M306_report(forReplay));
   }
 
 #endif // !DISABLE_M503
@@ -72,6 +72,11 @@ class MarlinSettings {
         static int mesh_slot_offset(const int8_t slot);
         static void store_mesh(const int8_t slot);
         static void load_mesh(const int8_t slot, void * const into=nullptr);
+        #if ENABLED(FAST_BOOT)
+          static bool mesh_pending,       // The boot mesh is loaded after setup()
+                      mesh_pending_active; // Leveling is enabled once it's loaded
+          static void load_pending_mesh();
+        #endif
 
         //static void delete_mesh();    // necessary if we have a MAT
         //static void defrag_meshes();  // "
@@ -112,6 +117,21 @@ class MarlinSettings {
       static int eeprom_index;
       static uint16_t working_crc;
 
+      #if ENABLED(EEPROM_SECTIONS)
+        static uint8_t section_id;          // Section being read or written
+        static int section_index;           // Position of its header (writing) or data (reading)
+        static uint16_t section_size,       // Stored size and CRC of the section being read
+                        section_crc;
+        static uint32_t section_ok;         // Sections that passed validation
+        static bool section_skip,           // Reading a section that can't be used
+                    section_forced;         // ...with 'validating' set to skip it
+        static uint8_t section_count(uint32_t bits);
+        static void section_write(const uint8_t id);
+        static void section_write_end();
+        static void section_read(const uint8_t id);
+        static void section_read_end();
+      #endif
+
       static bool EEPROM_START(int eeprom_offset) {
         if (!persistentStore.access_start()) { SERIAL_ECHO_MSG("No EEPROM."); return false; }
         eeprom_index = eeprom_offset;
@@ -130,16 +150,20 @@ class MarlinSettings {
       }
 
       template<typename T>
-      static void EEPROM_READ(T &VAR) {
-        persistentStore.read_data(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), &working_crc, !validating);
-      }
+      static void EEPROM_READ(T &VAR) { EEPROM_READ((uint8_t *) &VAR, sizeof(VAR)); }
 
       static void EEPROM_READ(uint8_t *VAR, size_t sizeof_VAR) {
+        #if ENABLED(EEPROM_SECTIONS)
+          if (section_skip) { eeprom_index += sizeof_VAR; return; }
+        #endif
         persistentStore.read_data(eeprom_index, VAR, sizeof_VAR, &working_crc, !validating);
       }
 
       template<typename T>
       static void EEPROM_READ_ALWAYS(T &VAR) {
+        #if ENABLED(EEPROM_SECTIONS)
+          if (section_skip) { memset((void *)&VAR, 0, sizeof(VAR)); eeprom_index += sizeof(VAR); return; }
+        #endif
         persistentStore.read_data(eeprom_index, (uint8_t *) &VAR, sizeof(VAR), &working_crc);
       }
 
@@ -1674,7 +1674,7 @@ void Stepper::pulse_phase_isr() {
       // Direct stepping is currently not ready for HAS_I_AXIS
       if (is_page) {
 
-        #if STEPPER_PAGE_FORMAT == SP_4x4D_128
+        #if STEPPER_PAGE_FORMAT == SP_4x4D_128 || STEPPER_PAGE_FORMAT == SP_4x4DR_128
 
           #define PAGE_SEGMENT_UPDATE(AXIS, VALUE) do{   \
                  if ((VALUE) <  7) SBI(dm, _AXIS(AXIS)); \
@@ -1690,7 +1690,7 @@ void Stepper::pulse_phase_isr() {
 
           switch (page_step_state.segment_steps) {
             case DirectStepping::Config::SEGMENT_STEPS:
-              page_step_state.segment_idx += 2;
+              page_step_state.segment_idx += DirectStepping::Config::SEGMENT_BYTES;
               page_step_state.segment_steps = 0;
               // fallthru
             case 0: {
@@ -1698,6 +1698,12 @@ void Stepper::pulse_phase_isr() {
                            high = page_step_state.page[page_step_state.segment_idx + 1];
               axis_bits_t dm = last_direction_bits;
 
+              #if STEPPER_PAGE_FORMAT == SP_4x4DR_128
+                // Apply the new segment rate on the next block phase
+                page_step_state.segment_rate = page_step_state.page[page_step_state.segment_idx + 2];
+                ticks_nominal = -1;
+              #endif
+
               PAGE_SEGMENT_UPDATE(X, low >> 4);
               PAGE_SEGMENT_UPDATE(Y, low & 0xF);
               PAGE_SEGMENT_UPDATE(Z, high >> 4);
@@ -1910,7 +1916,7 @@ uint32_t Stepper::block_phase_isr() {
     if (step_events_completed >= step_event_count) {
       #if ENABLED(DIRECT_STEPPING)
         // Direct stepping is currently not ready for HAS_I_AXIS
-        #if STEPPER_PAGE_FORMAT == SP_4x4D_128
+        #if STEPPER_PAGE_FORMAT == SP_4x4D_128 || STEPPER_PAGE_FORMAT == SP_4x4DR_128
           #define PAGE_SEGMENT_UPDATE_POS(AXIS) \
             count_position[_AXIS(AXIS)] += page_step_state.bd[_AXIS(AXIS)] - 128 * 7;
         #elif STEPPER_PAGE_FORMAT == SP_4x1_512 || STEPPER_PAGE_FORMAT == SP_4x2_256
@@ -2059,8 +2065,14 @@ uint32_t Stepper::block_phase_isr() {
 
         // Calculate the ticks_nominal for this nominal speed, if not done yet
         if (ticks_nominal < 0) {
+          uint32_t nominal_rate = current_block->nominal_rate;
+          #if ENABLED(DIRECT_STEPPING) && STEPPER_PAGE_FORMAT == SP_4x4DR_128
+            // Each page segment runs at (rate + 1) / 256 of the G6 page step rate
+            if (current_block->is_page())
+              nominal_rate = _MAX(1UL, (nominal_rate * (page_step_state.segment_rate + 1UL)) >> 8);
+          #endif
           // step_rate to timer interval and loops for the nominal speed
-          ticks_nominal = calc_timer_interval(current_block->nominal_rate, &steps_per_isr);
+          ticks_nominal = calc_timer_interval(nominal_rate, &steps_per_isr);
         }
 
         // The timer interval is just the nominal value for the nominal speed
@@ -2166,6 +2178,11 @@ uint32_t Stepper::block_phase_isr() {
             discard_current_block();
             return interval;
           }
+
+          #if STEPPER_PAGE_FORMAT == SP_4x4DR_128
+            // Start at the rate of the first segment, not the last one of the previous page
+            page_step_state.segment_rate = page_step_state.page[2];
+          #endif
         }
       #endif
 
@@ -145,8 +145,10 @@
   #endif
 #endif
 
-#if ENABLED(MPCTEMP)
+#if HAS_MPC
   #include <math.h>
+#endif
+#if ENABLED(MPCTEMP)
   #include "probe.h"
 #endif
 
@@ -166,6 +168,10 @@
   #include "../feature/power_monitor.h"
 #endif
 
+#if ENABLED(TEMP_TELEMETRY)
+  #include "../feature/temp_telemetry.h"
+#endif
+
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
 #endif
@@ -190,18 +196,6 @@
   #include "servo.h"
 #endif
 
-#if ANY(TEMP_SENSOR_0_IS_THERMISTOR, TEMP_SENSOR_1_IS_THERMISTOR, TEMP_SENSOR_2_IS_THERMISTOR, TEMP_SENSOR_3_IS_THERMISTOR, \
-        TEMP_SENSOR_4_IS_THERMISTOR, TEMP_SENSOR_5_IS_THERMISTOR, TEMP_SENSOR_6_IS_THERMISTOR, TEMP_SENSOR_7_IS_THERMISTOR )
-  #define HAS_HOTEND_THERMISTOR 1
-#endif
-
-#if HAS_HOTEND_THERMISTOR
-  #define NEXT_TEMPTABLE(N) ,TEMPTABLE_##N
-  #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
-  static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
-  static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
-#endif
-
 Temperature thermalManager;
 
 PGMSTR(str_t_thermal_runaway, STR_T_THERMAL_RUNAWAY);
@@ -449,7 +443,9 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
   raw_adc_t Temperature::mintemp_raw_BED = TEMP_SENSOR_BED_RAW_LO_TEMP,
             Temperature::maxtemp_raw_BED = TEMP_SENSOR_BED_RAW_HI_TEMP;
   TERN_(WATCH_BED, bed_watch_t Temperature::watch_bed); // = { 0 }
-  IF_DISABLED(PIDTEMPBED, millis_t Temperature::next_bed_check_ms);
+  #if NONE(PIDTEMPBED, MPCTEMPBED)
+    millis_t Temperature::next_bed_check_ms;
+  #endif
 #endif
 
 #if HAS_TEMP_CHAMBER
@@ -460,7 +456,9 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
     raw_adc_t Temperature::mintemp_raw_CHAMBER = TEMP_SENSOR_CHAMBER_RAW_LO_TEMP,
               Temperature::maxtemp_raw_CHAMBER = TEMP_SENSOR_CHAMBER_RAW_HI_TEMP;
     TERN_(WATCH_CHAMBER, chamber_watch_t Temperature::watch_chamber{0});
-    IF_DISABLED(PIDTEMPCHAMBER, millis_t Temperature::next_chamber_check_ms);
+    #if NONE(PIDTEMPCHAMBER, MPCTEMPCHAMBER)
+      millis_t Temperature::next_chamber_check_ms;
+    #endif
   #endif
 #endif
 
@@ -581,218 +579,251 @@ volatile bool Temperature::raw_temps_ready = false;
 
   inline void say_default_() { SERIAL_ECHOPGM("#define DEFAULT_"); }
 
-  /**
-   * PID Autotuning (M303)
-   *
-   * Alternately heat and cool the nozzle, observing its behavior to
-   * determine the best PID values to achieve a stable temperature.
-   * Needs sufficient heater power to make some overshoot at target
-   * temperature to succeed.
-   */
-  void Temperature::PID_autotune(const celsius_t target, const heater_id_t heater_id, const int8_t ncycles, const bool set_result/*=false*/) {
-    celsius_float_t current_temp = 0.0;
-    int cycles = 0;
-    bool heating = true;
-
-    millis_t next_temp_ms = millis(), t1 = next_temp_ms, t2 = next_temp_ms;
-    long t_high = 0, t_low = 0;
-
-    PID_t tune_pid = { 0, 0, 0 };
-    celsius_float_t maxT = 0, minT = 10000;
+  #if ENABLED(PIDTEMPCHAMBER)
+    #define C_TERN(T,A,B) ((T) ? (A) : (B))
+  #else
+    #define C_TERN(T,A,B) (B)
+  #endif
+  #if ENABLED(PIDTEMPBED)
+    #define B_TERN(T,A,B) ((T) ? (A) : (B))
+  #else
+    #define B_TERN(T,A,B) (B)
+  #endif
+  #define GHV(C,B,H) C_TERN(ischamber, C, B_TERN(isbed, B, H))
+  #define SHV(V) C_TERN(ischamber, temp_chamber.soft_pwm_amount = V, B_TERN(isbed, temp_bed.soft_pwm_amount = V, temp_hotend[heater_id].soft_pwm_amount = V))
+  #define ONHEATINGSTART() C_TERN(ischamber, printerEventLEDs.onChamberHeatingStart(), B_TERN(isbed, printerEventLEDs.onBedHeatingStart(), printerEventLEDs.onHotendHeatingStart()))
+  #define ONHEATING(S,C,T) C_TERN(ischamber, printerEventLEDs.onChamberHeating(S,C,T), B_TERN(isbed, printerEventLEDs.onBedHeating(S,C,T), printerEventLEDs.onHotendHeating(S,C,T)))
 
-    const bool isbed = (heater_id == H_BED),
-           ischamber = (heater_id == H_CHAMBER);
+  #define WATCH_PID DISABLED(NO_WATCH_PID_TUNING) && (BOTH(WATCH_CHAMBER, PIDTEMPCHAMBER) || BOTH(WATCH_BED, PIDTEMPBED) || BOTH(WATCH_HOTENDS, PIDTEMP))
 
-    #if ENABLED(PIDTEMPCHAMBER)
-      #define C_TERN(T,A,B) ((T) ? (A) : (B))
+  #if WATCH_PID
+    #if BOTH(THERMAL_PROTECTION_CHAMBER, PIDTEMPCHAMBER)
+      #define C_GTV(T,A,B) ((T) ? (A) : (B))
     #else
-      #define C_TERN(T,A,B) (B)
+      #define C_GTV(T,A,B) (B)
     #endif
-    #if ENABLED(PIDTEMPBED)
-      #define B_TERN(T,A,B) ((T) ? (A) : (B))
+    #if BOTH(THERMAL_PROTECTION_BED, PIDTEMPBED)
+      #define B_GTV(T,A,B) ((T) ? (A) : (B))
     #else
-      #define B_TERN(T,A,B) (B)
+      #define B_GTV(T,A,B) (B)
     #endif
-    #define GHV(C,B,H) C_TERN(ischamber, C, B_TERN(isbed, B, H))
-    #define SHV(V) C_TERN(ischamber, temp_chamber.soft_pwm_amount = V, B_TERN(isbed, temp_bed.soft_pwm_amount = V, temp_hotend[heater_id].soft_pwm_amount = V))
-    #define ONHEATINGSTART() C_TERN(ischamber, printerEventLEDs.onChamberHeatingStart(), B_TERN(isbed, printerEventLEDs.onBedHeatingStart(), printerEventLEDs.onHotendHeatingStart()))
-    #define ONHEATING(S,C,T) C_TERN(ischamber, printerEventLEDs.onChamberHeating(S,C,T), B_TERN(isbed, printerEventLEDs.onBedHeating(S,C,T), printerEventLEDs.onHotendHeating(S,C,T)))
+    #define GTV(C,B,H) C_GTV(ischamber, C, B_GTV(isbed, B, H))
+  #endif
 
-    #define WATCH_PID DISABLED(NO_WATCH_PID_TUNING) && (BOTH(WATCH_CHAMBER, PIDTEMPCHAMBER) || BOTH(WATCH_BED, PIDTEMPBED) || BOTH(WATCH_HOTENDS, PIDTEMP))
+  // Did the temperature overshoot very far?
+  #ifndef MAX_OVERSHOOT_PID_AUTOTUNE
+    #define MAX_OVERSHOOT_PID_AUTOTUNE 30
+  #endif
+
+  // Timeout after MAX_CYCLE_TIME_PID_AUTOTUNE minutes since the last undershoot/overshoot cycle
+  #ifndef MAX_CYCLE_TIME_PID_AUTOTUNE
+    #define MAX_CYCLE_TIME_PID_AUTOTUNE 20L
+  #endif
 
+  /**
+   * Relay autotune state for one heater. The caller fills in the
+   * settings, then PID_relay_start initializes the rest.
+   */
+  struct pid_relay_t {
+    heater_id_t heater_id;
+    celsius_t target;
+    int8_t ncycles;
+    bool set_result,
+         background;    // Messages name the heater (M303 B)
+    bool heating;
+    int cycles;
+    uint8_t pwm;        // Relay output for the heater
+    millis_t t1, t2;
+    long t_high, t_low, bias, d;
+    celsius_float_t maxT, minT;
+    PID_t tune_pid;
     #if WATCH_PID
-      #if BOTH(THERMAL_PROTECTION_CHAMBER, PIDTEMPCHAMBER)
-        #define C_GTV(T,A,B) ((T) ? (A) : (B))
-      #else
-        #define C_GTV(T,A,B) (B)
-      #endif
-      #if BOTH(THERMAL_PROTECTION_BED, PIDTEMPBED)
-        #define B_GTV(T,A,B) ((T) ? (A) : (B))
-      #else
-        #define B_GTV(T,A,B) (B)
-      #endif
-      #define GTV(C,B,H) C_GTV(ischamber, C, B_GTV(isbed, B, H))
-      const uint16_t watch_temp_period = GTV(WATCH_CHAMBER_TEMP_PERIOD, WATCH_BED_TEMP_PERIOD, WATCH_TEMP_PERIOD);
-      const uint8_t watch_temp_increase = GTV(WATCH_CHAMBER_TEMP_INCREASE, WATCH_BED_TEMP_INCREASE, WATCH_TEMP_INCREASE);
-      const celsius_float_t watch_temp_target = celsius_float_t(target - (watch_temp_increase + GTV(TEMP_CHAMBER_HYSTERESIS, TEMP_BED_HYSTERESIS, TEMP_HYSTERESIS) + 1));
-      millis_t temp_change_ms = next_temp_ms + SEC_TO_MS(watch_temp_period);
-      celsius_float_t next_watch_temp = 0.0;
-      bool heated = false;
+      millis_t temp_change_ms;
+      celsius_float_t next_watch_temp;
+      bool heated;
     #endif
+  };
 
-    TERN_(HAS_FAN_LOGIC, fan_update_ms = next_temp_ms + fan_update_interval_ms);
-
-    TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_STARTED));
-    TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(isbed ? PID_BED_START : PID_EXTR_START));
-
-    if (target > GHV(CHAMBER_MAX_TARGET, BED_MAX_TARGET, temp_range[heater_id].maxtemp - (HOTEND_OVERSHOOT))) {
-      SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
-      SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
-      TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_TEMP_TOO_HIGH));
-      TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(PID_TEMP_TOO_HIGH));
-      TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_PID_TEMP_TOO_HIGH)));
-      return;
-    }
-
+  static void say_pid_relay(const pid_relay_t &r) {
     SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
-    SERIAL_ECHOLNPGM(STR_PID_AUTOTUNE_START);
-
-    disable_all_heaters();
-    TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+    if (r.background) switch (r.heater_id) {
+      #if ENABLED(PIDTEMPBED)
+        case H_BED: SERIAL_ECHOPGM(" bed"); break;
+      #endif
+      #if ENABLED(PIDTEMPCHAMBER)
+        case H_CHAMBER: SERIAL_ECHOPGM(" chamber"); break;
+      #endif
+      default: SERIAL_ECHOPGM(" E", int(r.heater_id)); break;
+    }
+  }
 
-    long bias = GHV(MAX_CHAMBER_POWER, MAX_BED_POWER, PID_MAX) >> 1, d = bias;
-    SHV(bias);
+  #if EITHER(HEATER_POWER_BUDGET, PID_AUTOTUNE_CONCURRENT)
+    // Power drawn by a heater with the relay fully on
+    static float pid_tune_watts(const heater_id_t hid) {
+      switch (hid) {
+        #if ENABLED(PIDTEMPBED)
+          case H_BED: return float(BED_HEATER_WATTS) * (MAX_BED_POWER) / 255;
+        #endif
+        #if ENABLED(PIDTEMPCHAMBER)
+          case H_CHAMBER: return float(CHAMBER_HEATER_WATTS) * (MAX_CHAMBER_POWER) / 255;
+        #endif
+        default: return TERN0(PIDTEMP, float(HOTEND_HEATER_WATTS) * (PID_MAX) / 255);
+      }
+    }
+  #endif
 
-    #if ENABLED(PRINTER_EVENT_LEDS)
-      const celsius_float_t start_temp = GHV(degChamber(), degBed(), degHotend(heater_id));
-      LEDColor color = ONHEATINGSTART();
+  void Temperature::PID_relay_start(pid_relay_t &r, const millis_t &ms) {
+    const heater_id_t heater_id = r.heater_id;
+    const bool isbed = (heater_id == H_BED),
+           ischamber = (heater_id == H_CHAMBER);
+    UNUSED(isbed); UNUSED(ischamber);
+
+    r.heating = true;
+    r.cycles = 0;
+    r.t1 = r.t2 = ms;
+    r.t_high = r.t_low = 0;
+    r.maxT = 0; r.minT = 10000;
+    r.tune_pid = { 0, 0, 0 };
+    r.bias = r.d = GHV(MAX_CHAMBER_POWER, MAX_BED_POWER, PID_MAX) >> 1;
+    r.pwm = r.bias;
+    #if WATCH_PID
+      r.temp_change_ms = ms + SEC_TO_MS(GTV(WATCH_CHAMBER_TEMP_PERIOD, WATCH_BED_TEMP_PERIOD, WATCH_TEMP_PERIOD));
+      r.next_watch_temp = 0;
+      r.heated = false;
     #endif
 
-    TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = false);
-
-    LCD_MESSAGE(MSG_HEATING);
-
-    // PID Tuning loop
-    wait_for_heatup = true;
-    while (wait_for_heatup) { // Can be interrupted with M108
-
-      const millis_t ms = millis();
+    say_pid_relay(r);
+    SERIAL_ECHOLNPGM(STR_PID_AUTOTUNE_START);
+  }
 
-      if (updateTemperaturesIfReady()) { // temp sample ready
+  /**
+   * Step the relay with a new temperature sample, updating r.pwm.
+   * Calls _temp_error if the heater fails to heat or loses heat.
+   */
+  Temperature::PIDRelayResult Temperature::PID_relay_update(pid_relay_t &r, const millis_t &ms) {
+    const heater_id_t heater_id = r.heater_id;
+    const bool isbed = (heater_id == H_BED),
+           ischamber = (heater_id == H_CHAMBER);
+    const celsius_t target = r.target;
 
-        // Get the current temperature and constrain it
-        current_temp = GHV(degChamber(), degBed(), degHotend(heater_id));
-        NOLESS(maxT, current_temp);
-        NOMORE(minT, current_temp);
+    #if ENABLED(HEATER_POWER_BUDGET)
+      // Ku and Tu are only right if the heater gets the power the relay asks for
+      if (GHV(temp_chamber.budget_refused(), temp_bed.budget_refused(), temp_hotend[heater_id].budget_refused()))
+        return PID_RELAY_OVER_BUDGET;
+    #endif
 
-        #if ENABLED(PRINTER_EVENT_LEDS)
-          ONHEATING(start_temp, current_temp, target);
-        #endif
+    // Get the current temperature and constrain it
+    const celsius_float_t current_temp = GHV(degChamber(), degBed(), degHotend(heater_id));
+    NOLESS(r.maxT, current_temp);
+    NOMORE(r.minT, current_temp);
 
-        TERN_(HAS_FAN_LOGIC, manage_extruder_fans(ms));
+    if (r.heating && current_temp > target && ELAPSED(ms, r.t2 + 5000UL)) {
+      r.heating = false;
+      r.pwm = (r.bias - r.d) >> 1;
+      r.t1 = ms;
+      r.t_high = r.t1 - r.t2;
+      r.maxT = target;
+    }
 
-        if (heating && current_temp > target && ELAPSED(ms, t2 + 5000UL)) {
-          heating = false;
-          SHV((bias - d) >> 1);
-          t1 = ms;
-          t_high = t1 - t2;
-          maxT = target;
+    if (!r.heating && current_temp < target && ELAPSED(ms, r.t1 + 5000UL)) {
+      r.heating = true;
+      r.t2 = ms;
+      r.t_low = r.t2 - r.t1;
+      if (r.cycles > 0) {
+        const long max_pow = GHV(MAX_CHAMBER_POWER, MAX_BED_POWER, PID_MAX);
+        r.bias += (r.d * (r.t_high - r.t_low)) / (r.t_low + r.t_high);
+        LIMIT(r.bias, 20, max_pow - 20);
+        r.d = (r.bias > max_pow >> 1) ? max_pow - 1 - r.bias : r.bias;
+
+        if (r.background) say_pid_relay(r);
+        SERIAL_ECHOPGM(STR_BIAS, r.bias, STR_D_COLON, r.d, STR_T_MIN, r.minT, STR_T_MAX, r.maxT);
+        if (r.cycles > 2) {
+          const float Ku = (4.0f * r.d) / (float(M_PI) * (r.maxT - r.minT) * 0.5f),
+                      Tu = float(r.t_low + r.t_high) * 0.001f,
+                      pf = (ischamber || isbed) ? 0.2f : 0.6f,
+                      df = (ischamber || isbed) ? 1.0f / 3.0f : 1.0f / 8.0f;
+
+          r.tune_pid.Kp = Ku * pf;
+          r.tune_pid.Ki = r.tune_pid.Kp * 2.0f / Tu;
+          r.tune_pid.Kd = r.tune_pid.Kp * Tu * df;
+
+          SERIAL_ECHOLNPGM(STR_KU, Ku, STR_TU, Tu);
+          if (ischamber || isbed)
+            SERIAL_ECHOLNPGM(" No overshoot");
+          else
+            SERIAL_ECHOLNPGM(STR_CLASSIC_PID);
+          SERIAL_ECHOLNPGM(STR_KP, r.tune_pid.Kp, STR_KI, r.tune_pid.Ki, STR_KD, r.tune_pid.Kd);
         }
+        else
+          SERIAL_EOL();
+      }
+      r.pwm = (r.bias + r.d) >> 1;
+      r.cycles++;
+      r.minT = target;
+    }
 
-        if (!heating && current_temp < target && ELAPSED(ms, t1 + 5000UL)) {
-          heating = true;
-          t2 = ms;
-          t_low = t2 - t1;
-          if (cycles > 0) {
-            const long max_pow = GHV(MAX_CHAMBER_POWER, MAX_BED_POWER, PID_MAX);
-            bias += (d * (t_high - t_low)) / (t_low + t_high);
-            LIMIT(bias, 20, max_pow - 20);
-            d = (bias > max_pow >> 1) ? max_pow - 1 - bias : bias;
-
-            SERIAL_ECHOPGM(STR_BIAS, bias, STR_D_COLON, d, STR_T_MIN, minT, STR_T_MAX, maxT);
-            if (cycles > 2) {
-              const float Ku = (4.0f * d) / (float(M_PI) * (maxT - minT) * 0.5f),
-                          Tu = float(t_low + t_high) * 0.001f,
-                          pf = (ischamber || isbed) ? 0.2f : 0.6f,
-                          df = (ischamber || isbed) ? 1.0f / 3.0f : 1.0f / 8.0f;
-
-              tune_pid.Kp = Ku * pf;
-              tune_pid.Ki = tune_pid.Kp * 2.0f / Tu;
-              tune_pid.Kd = tune_pid.Kp * Tu * df;
-
-              SERIAL_ECHOLNPGM(STR_KU, Ku, STR_TU, Tu);
-              if (ischamber || isbed)
-                SERIAL_ECHOLNPGM(" No overshoot");
-              else
-                SERIAL_ECHOLNPGM(STR_CLASSIC_PID);
-              SERIAL_ECHOLNPGM(STR_KP, tune_pid.Kp, STR_KI, tune_pid.Ki, STR_KD, tune_pid.Kd);
-            }
+    if (current_temp > target + MAX_OVERSHOOT_PID_AUTOTUNE) return PID_RELAY_TOO_HOT;
+
+    // Make sure heating is actually working
+    #if WATCH_PID
+      if (BOTH(WATCH_BED, WATCH_HOTENDS) || isbed == DISABLED(WATCH_HOTENDS) || ischamber == DISABLED(WATCH_HOTENDS)) {
+        const uint8_t watch_temp_increase = GTV(WATCH_CHAMBER_TEMP_INCREASE, WATCH_BED_TEMP_INCREASE, WATCH_TEMP_INCREASE);
+        if (!r.heated) {                                                // If not yet reached target...
+          if (current_temp > r.next_watch_temp) {                       // Over the watch temp?
+            r.next_watch_temp = current_temp + watch_temp_increase;     // - set the next temp to watch for
+            r.temp_change_ms = ms + SEC_TO_MS(GTV(WATCH_CHAMBER_TEMP_PERIOD, WATCH_BED_TEMP_PERIOD, WATCH_TEMP_PERIOD)); // - move the expiration timer up
+            if (current_temp > target - (watch_temp_increase + GTV(TEMP_CHAMBER_HYSTERESIS, TEMP_BED_HYSTERESIS, TEMP_HYSTERESIS) + 1))
+              r.heated = true;                                          // - Flag if target temperature reached
           }
-          SHV((bias + d) >> 1);
-          TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PID_CYCLE), cycles, ncycles));
-          cycles++;
-          minT = target;
+          else if (ELAPSED(ms, r.temp_change_ms))                       // Watch timer expired
+            _temp_error(heater_id, FPSTR(str_t_heating_failed), GET_TEXT_F(MSG_HEATING_FAILED_LCD));
         }
+        else if (current_temp < target - (MAX_OVERSHOOT_PID_AUTOTUNE))  // Heated, then temperature fell too far?
+          _temp_error(heater_id, FPSTR(str_t_thermal_runaway), GET_TEXT_F(MSG_THERMAL_RUNAWAY));
       }
+    #endif
 
-      // Did the temperature overshoot very far?
-      #ifndef MAX_OVERSHOOT_PID_AUTOTUNE
-        #define MAX_OVERSHOOT_PID_AUTOTUNE 30
-      #endif
-      if (current_temp > target + MAX_OVERSHOOT_PID_AUTOTUNE) {
-        SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+    if ((ms - _MIN(r.t1, r.t2)) > (MAX_CYCLE_TIME_PID_AUTOTUNE * 60L * 1000L)) return PID_RELAY_TIMEOUT;
+
+    return (r.cycles > r.ncycles && r.cycles > 2) ? PID_RELAY_DONE : PID_RELAY_RUNNING;
+  }
+
+  // Report the outcome of a relay autotune and apply the result if requested
+  void Temperature::PID_relay_end(const pid_relay_t &r, const PIDRelayResult result) {
+    const heater_id_t heater_id = r.heater_id;
+    const bool isbed = (heater_id == H_BED),
+           ischamber = (heater_id == H_CHAMBER);
+    UNUSED(isbed); UNUSED(ischamber);
+
+    switch (result) {
+      case PID_RELAY_TOO_HOT:
+        say_pid_relay(r);
         SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
         TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_TEMP_TOO_HIGH));
         TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(PID_TEMP_TOO_HIGH));
         TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_PID_TEMP_TOO_HIGH)));
         break;
-      }
-
-      // Report heater states every 2 seconds
-      if (ELAPSED(ms, next_temp_ms)) {
-        #if HAS_TEMP_SENSOR
-          print_heater_states(heater_id < 0 ? active_extruder : (int8_t)heater_id);
-          SERIAL_EOL();
-        #endif
-        next_temp_ms = ms + 2000UL;
 
-        // Make sure heating is actually working
-        #if WATCH_PID
-          if (BOTH(WATCH_BED, WATCH_HOTENDS) || isbed == DISABLED(WATCH_HOTENDS) || ischamber == DISABLED(WATCH_HOTENDS)) {
-            if (!heated) {                                            // If not yet reached target...
-              if (current_temp > next_watch_temp) {                   // Over the watch temp?
-                next_watch_temp = current_temp + watch_temp_increase; // - set the next temp to watch for
-                temp_change_ms = ms + SEC_TO_MS(watch_temp_period);   // - move the expiration timer up
-                if (current_temp > watch_temp_target) heated = true;  // - Flag if target temperature reached
-              }
-              else if (ELAPSED(ms, temp_change_ms))                   // Watch timer expired
-                _temp_error(heater_id, FPSTR(str_t_heating_failed), GET_TEXT_F(MSG_HEATING_FAILED_LCD));
-            }
-            else if (current_temp < target - (MAX_OVERSHOOT_PID_AUTOTUNE)) // Heated, then temperature fell too far?
-              _temp_error(heater_id, FPSTR(str_t_thermal_runaway), GET_TEXT_F(MSG_THERMAL_RUNAWAY));
-          }
-        #endif
-      } // every 2 seconds
-
-      // Timeout after MAX_CYCLE_TIME_PID_AUTOTUNE minutes since the last undershoot/overshoot cycle
-      #ifndef MAX_CYCLE_TIME_PID_AUTOTUNE
-        #define MAX_CYCLE_TIME_PID_AUTOTUNE 20L
-      #endif
-      if ((ms - _MIN(t1, t2)) > (MAX_CYCLE_TIME_PID_AUTOTUNE * 60L * 1000L)) {
+      case PID_RELAY_TIMEOUT:
         TERN_(DWIN_CREALITY_LCD, DWIN_Popup_Temperature(0));
         TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(PID_TUNING_TIMEOUT));
         TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_TUNING_TIMEOUT));
         TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_PID_TIMEOUT)));
-        SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+        say_pid_relay(r);
         SERIAL_ECHOLNPGM(STR_PID_TIMEOUT);
         break;
-      }
 
-      if (cycles > ncycles && cycles > 2) {
-        SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+      case PID_RELAY_OVER_BUDGET:
+        say_pid_relay(r);
+        SERIAL_ECHOLNPGM(STR_PID_OVER_BUDGET);
+        break;
+
+      case PID_RELAY_DONE: {
+        say_pid_relay(r);
         SERIAL_ECHOLNPGM(STR_PID_AUTOTUNE_FINISHED);
         TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_PID_AUTOTUNE_DONE)));
 
+        const PID_t &tune_pid = r.tune_pid;
         #if EITHER(PIDTEMPBED, PIDTEMPCHAMBER)
           FSTR_P const estring = GHV(F("chamber"), F("bed"), FPSTR(NUL_STR));
           say_default_(); SERIAL_ECHOF(estring); SERIAL_ECHOLNPGM("Kp ", tune_pid.Kp);
@@ -832,15 +863,112 @@ volatile bool Temperature::raw_temps_ready = false;
         #endif
 
         // Use the result? (As with "M303 U1")
-        if (set_result)
+        if (r.set_result)
           GHV(_set_chamber_pid(tune_pid), _set_bed_pid(tune_pid), _set_hotend_pid(heater_id, tune_pid));
 
-        TERN_(PRINTER_EVENT_LEDS, printerEventLEDs.onPidTuningDone(color));
+        TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_DONE));
+        TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(PID_DONE));
+      } break;
+
+      default: break;
+    }
+  }
+
+  /**
+   * PID Autotuning (M303)
+   *
+   * Alternately heat and cool the nozzle, observing its behavior to
+   * determine the best PID values to achieve a stable temperature.
+   * Needs sufficient heater power to make some overshoot at target
+   * temperature to succeed.
+   */
+  void Temperature::PID_autotune(const celsius_t target, const heater_id_t heater_id, const int8_t ncycles, const bool set_result/*=false*/) {
+    millis_t next_temp_ms = millis();
+
+    const bool isbed = (heater_id == H_BED),
+           ischamber = (heater_id == H_CHAMBER);
+    UNUSED(ischamber);
+
+    TERN_(HAS_FAN_LOGIC, fan_update_ms = next_temp_ms + fan_update_interval_ms);
+
+    TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_STARTED));
+    TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(isbed ? PID_BED_START : PID_EXTR_START));
+
+    if (target > GHV(CHAMBER_MAX_TARGET, BED_MAX_TARGET, temp_range[heater_id].maxtemp - (HOTEND_OVERSHOOT))) {
+      SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+      SERIAL_ECHOLNPGM(STR_PID_TEMP_TOO_HIGH);
+      TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_TEMP_TOO_HIGH));
+      TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(PID_TEMP_TOO_HIGH));
+      TERN_(HOST_PROMPT_SUPPORT, hostui.notify(GET_TEXT_F(MSG_PID_TEMP_TOO_HIGH)));
+      return;
+    }
 
+    #if ENABLED(HEATER_POWER_BUDGET)
+      if (pid_tune_watts(heater_id) > HEATER_POWER_LIMIT) {
+        SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+        SERIAL_ECHOLNPGM(STR_PID_OVER_BUDGET);
         TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_DONE));
         TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(PID_DONE));
+        return;
+      }
+    #endif
+
+    disable_all_heaters();
+    TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+
+    pid_relay_t relay;
+    relay.heater_id = heater_id;
+    relay.target = target;
+    relay.ncycles = ncycles;
+    relay.set_result = set_result;
+    relay.background = false;
+    PID_relay_start(relay, next_temp_ms);
+    SHV(relay.pwm);
+    TERN_(HEATER_POWER_BUDGET, manage_power_budget());
+
+    #if ENABLED(PRINTER_EVENT_LEDS)
+      const celsius_float_t start_temp = GHV(degChamber(), degBed(), degHotend(heater_id));
+      LEDColor color = ONHEATINGSTART();
+    #endif
+
+    TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = false);
 
-        goto EXIT_M303;
+    LCD_MESSAGE(MSG_HEATING);
+
+    // PID Tuning loop
+    PIDRelayResult result = PID_RELAY_RUNNING;
+    wait_for_heatup = true;
+    while (wait_for_heatup) { // Can be interrupted with M108
+
+      const millis_t ms = millis();
+
+      if (updateTemperaturesIfReady()) { // temp sample ready
+
+        #if ENABLED(PRINTER_EVENT_LEDS)
+          ONHEATING(start_temp, GHV(degChamber(), degBed(), degHotend(heater_id)), target);
+        #endif
+
+        TERN_(HAS_FAN_LOGIC, manage_extruder_fans(ms));
+
+        TERN_(HAS_STATUS_MESSAGE, const int cycles = relay.cycles);
+        result = PID_relay_update(relay, ms);
+        SHV(relay.pwm);
+        TERN_(HEATER_POWER_BUDGET, manage_power_budget());
+        TERN_(HEATER_HARDWARE_PWM, update_heater_pwm());
+        #if HAS_STATUS_MESSAGE
+          if (relay.cycles != cycles) ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PID_CYCLE), cycles, ncycles);
+        #endif
+
+        if (result != PID_RELAY_RUNNING) break;
+      }
+
+      // Report heater states every 2 seconds
+      if (ELAPSED(ms, next_temp_ms)) {
+        #if HAS_TEMP_SENSOR
+          print_heater_states(heater_id < 0 ? active_extruder : (int8_t)heater_id);
+          SERIAL_EOL();
+        #endif
+        next_temp_ms = ms + 2000UL;
       }
 
       // Run HAL idle tasks
@@ -851,29 +979,218 @@ volatile bool Temperature::raw_temps_ready = false;
     }
     wait_for_heatup = false;
 
-    disable_all_heaters();
+    PID_relay_end(relay, result);
 
-    TERN_(PRINTER_EVENT_LEDS, printerEventLEDs.onPidTuningDone(color));
+    if (result != PID_RELAY_DONE) {
+      disable_all_heaters();
+      TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_DONE));
+      TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(PID_DONE));
+    }
 
-    TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_DONE));
-    TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(PID_DONE));
+    TERN_(PRINTER_EVENT_LEDS, printerEventLEDs.onPidTuningDone(color));
 
-    EXIT_M303:
-      TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = true);
-      return;
+    TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = true);
   }
 
+  #if ENABLED(PID_AUTOTUNE_CONCURRENT)
+
+    /**
+     * Background PID Autotuning (M303 B)
+     *
+     * The same relay procedure as PID_autotune, kept in a job per heater and
+     * stepped by manage_heater so it doesn't block. A queued job starts when
+     * its heater fits in HEATER_POWER_LIMIT with the ones already running.
+     */
+    #define PID_TUNE_JOBS (TERN0(PIDTEMP, HOTENDS) + ENABLED(PIDTEMPBED) + ENABLED(PIDTEMPCHAMBER))
+
+    typedef struct {
+      enum : uint8_t { IDLE, QUEUED, RUNNING } state;
+      pid_relay_t relay;
+    } pid_tune_job_t;
+
+    static pid_tune_job_t pid_tune_job[PID_TUNE_JOBS];
+
+    static pid_tune_job_t* pid_tune_job_for(const heater_id_t hid) {
+      LOOP_L_N(i, PID_TUNE_JOBS)
+        if (pid_tune_job[i].state != pid_tune_job_t::IDLE && pid_tune_job[i].relay.heater_id == hid)
+          return &pid_tune_job[i];
+      return nullptr;
+    }
+
+    void Temperature::PID_autotune_start(const celsius_t target, const heater_id_t heater_id, const int8_t ncycles, const bool set_result/*=false*/) {
+      const bool isbed = (heater_id == H_BED),
+             ischamber = (heater_id == H_CHAMBER);
+      UNUSED(isbed); UNUSED(ischamber);
+
+      pid_relay_t relay;
+      relay.heater_id = heater_id;
+      relay.target = target;
+      relay.ncycles = ncycles;
+      relay.set_result = set_result;
+      relay.background = true;
+
+      if (target > GHV(CHAMBER_MAX_TARGET, BED_MAX_TARGET, temp_range[heater_id].maxtemp - (HOTEND_OVERSHOOT))) {
+        PID_relay_end(relay, PID_RELAY_TOO_HOT);
+        return;
+      }
+
+      // A job that can never fit within the limit would wait in the queue forever
+      if (pid_tune_watts(heater_id) > HEATER_POWER_LIMIT) {
+        PID_relay_end(relay, PID_RELAY_OVER_BUDGET);
+        return;
+      }
+
+      // Restart the heater's job or take a free one
+      pid_tune_job_t *job = pid_tune_job_for(heater_id);
+      for (uint8_t i = 0; !job && i < PID_TUNE_JOBS; ++i)
+        if (pid_tune_job[i].state == pid_tune_job_t::IDLE) job = &pid_tune_job[i];
+      if (!job) {
+        say_pid_relay(relay);
+        SERIAL_ECHOLNPGM(" can't start, all tuning slots are busy");
+        return;
+      }
+
+      GHV(setTargetChamber(0), setTargetBed(0), setTargetHotend(0, heater_id));
+
+      job->state = pid_tune_job_t::QUEUED;
+      job->relay = relay;
+      job->relay.pwm = 0;
+
+      TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_STARTED));
+      TERN_(DWIN_LCD_PROUI, DWIN_PidTuning(isbed ? PID_BED_START : PID_EXTR_START));
+
+      say_pid_relay(relay);
+      SERIAL_ECHOLNPGM(" queued");
+    }
+
+    void Temperature::PID_autotune_cancel(const heater_id_t heater_id/*=H_NONE*/) {
+      LOOP_L_N(i, PID_TUNE_JOBS) {
+        pid_tune_job_t &job = pid_tune_job[i];
+        if (job.state == pid_tune_job_t::IDLE || (heater_id != H_NONE && job.relay.heater_id != heater_id)) continue;
+        job.state = pid_tune_job_t::IDLE;
+        say_pid_relay(job.relay);
+        SERIAL_ECHOLNPGM(" canceled");
+      }
+    }
+
+    // The relay output for a heater being tuned, or -1 to let the heater's own control run
+    int16_t Temperature::PID_autotune_pwm(const heater_id_t heater_id) {
+      const pid_tune_job_t * const job = pid_tune_job_for(heater_id);
+      return job ? (job->state == pid_tune_job_t::RUNNING ? job->relay.pwm : 0) : -1;
+    }
+
+    /**
+     * The target for thermal runaway protection while a heater is tuned.
+     * The relay swings around the tuning target, so hold the heater
+     * within MAX_OVERSHOOT_PID_AUTOTUNE below it once it has heated.
+     */
+    celsius_t Temperature::PID_autotune_runaway_target(const heater_id_t heater_id, const celsius_t target) {
+      const pid_tune_job_t * const job = pid_tune_job_for(heater_id);
+      return (job && job->state == pid_tune_job_t::RUNNING) ? job->relay.target - (MAX_OVERSHOOT_PID_AUTOTUNE) : target;
+    }
+
+    void Temperature::PID_autotune_task(const millis_t &ms) {
+
+      // Start queued jobs that fit within the power budget
+      float watts = 0;
+      LOOP_L_N(i, PID_TUNE_JOBS)
+        if (pid_tune_job[i].state == pid_tune_job_t::RUNNING) watts += pid_tune_watts(pid_tune_job[i].relay.heater_id);
+
+      LOOP_L_N(i, PID_TUNE_JOBS) {
+        pid_tune_job_t &job = pid_tune_job[i];
+        if (job.state != pid_tune_job_t::QUEUED) continue;
+        const float w = pid_tune_watts(job.relay.heater_id);
+        if (watts + w > HEATER_POWER_LIMIT) continue;
+
+        watts += w;
+        job.state = pid_tune_job_t::RUNNING;
+        TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
+        PID_relay_start(job.relay, ms);
+      }
+
+      bool tuning = false;
+
+      LOOP_L_N(i, PID_TUNE_JOBS) {
+        pid_tune_job_t &job = pid_tune_job[i];
+        if (job.state != pid_tune_job_t::RUNNING) continue;
+
+        const PIDRelayResult result = PID_relay_update(job.relay, ms);
+        if (result == PID_RELAY_RUNNING)
+          tuning = true;
+        else {
+          job.state = pid_tune_job_t::IDLE;
+          PID_relay_end(job.relay, result);
+        }
+      }
+
+      TERN_(NO_FAN_SLOWING_IN_PID_TUNING, adaptive_fan_slowing = !tuning);
+      UNUSED(tuning);
+    }
+
+  #endif // PID_AUTOTUNE_CONCURRENT
+
 #endif // HAS_PID_HEATING
 
-#if ENABLED(MPCTEMP)
+#if HAS_MPC
 
-  void Temperature::MPC_autotune() {
-    auto housekeeping = [] (millis_t& ms, celsius_float_t& current_temp, millis_t& next_report_ms) {
+  void Temperature::MPC_autotune(const heater_id_t hid/*=H_E0*/) {
+
+    // Beds and chambers are tuned in place. Only hotends have fan and filament terms.
+    MPCHeaterInfo *heater_ptr;
+    celsius_t tuning_temp;
+    uint8_t max_power;
+    FSTR_P name;
+    switch (hid) {
+      #if ENABLED(MPCTEMPBED)
+        case H_BED:
+          heater_ptr = &temp_bed; tuning_temp = MPC_BED_TUNING_TEMP; max_power = MAX_BED_POWER; name = F("BED_");
+          break;
+      #endif
+      #if ENABLED(MPCTEMPCHAMBER)
+        case H_CHAMBER:
+          heater_ptr = &temp_chamber; tuning_temp = MPC_CHAMBER_TUNING_TEMP; max_power = MAX_CHAMBER_POWER; name = F("CHAMBER_");
+          break;
+      #endif
+      default:
+        #if ENABLED(MPCTEMP)
+          // The tune uses the active extruder's fan and position
+          if (hid >= 0 && hid == active_extruder) {
+            heater_ptr = &temp_hotend[hid]; tuning_temp = 200; max_power = MPC_MAX; name = FPSTR(NUL_STR);
+            break;
+          }
+        #endif
+        SERIAL_ECHOPGM(STR_MPC_AUTOTUNE);
+        SERIAL_ECHOLNPGM(STR_PID_BAD_HEATER_ID);
+        return;
+    }
+
+    const bool is_hotend = hid >= 0;
+    MPCHeaterInfo &heater = *heater_ptr;
+    MPC_t &constants = heater.constants;
+
+    // Beds and chambers respond much more slowly than hotends, so wait longer at each stage
+    const uint8_t time_scale = is_hotend ? 1 : 6;
+
+    auto get_output = [hid]() -> float {
+      switch (hid) {
+        #if ENABLED(MPCTEMPBED)
+          case H_BED: return get_pid_output_bed();
+        #endif
+        #if ENABLED(MPCTEMPCHAMBER)
+          case H_CHAMBER: return get_pid_output_chamber();
+        #endif
+        default: return TERN0(MPCTEMP, get_pid_output_hotend(active_extruder));
+      }
+    };
+
+    auto housekeeping = [&heater] (millis_t& ms, celsius_float_t& current_temp, millis_t& next_report_ms) {
       ms = millis();
 
       if (updateTemperaturesIfReady()) { // temp sample ready
-        current_temp = degHotend(active_extruder);
+        current_temp = heater.celsius;
         TERN_(HAS_FAN_LOGIC, manage_extruder_fans(ms));
+        TERN_(HEATER_POWER_BUDGET, manage_power_budget());
+        TERN_(HEATER_HARDWARE_PWM, update_heater_pwm());
       }
 
       if (ELAPSED(ms, next_report_ms)) {
@@ -896,42 +1213,58 @@ volatile bool Temperature::raw_temps_ready = false;
     };
 
     struct OnExit {
+      MPCHeaterInfo &heater;
+      const bool is_hotend;
       ~OnExit() {
         wait_for_heatup = false;
 
         ui.reset_status();
 
-        temp_hotend[active_extruder].target = 0.0f;
-        temp_hotend[active_extruder].soft_pwm_amount = 0;
-        #if HAS_FAN
-          set_fan_speed(EITHER(MPC_FAN_0_ALL_HOTENDS, MPC_FAN_0_ACTIVE_HOTEND) ? 0 : active_extruder, 0);
-          planner.sync_fan_speeds(fan_speed);
+        heater.target = 0;
+        heater.soft_pwm_amount = 0;
+
+        #if ENABLED(MPCTEMP)
+          if (is_hotend) {
+            #if HAS_FAN
+              set_fan_speed(EITHER(MPC_FAN_0_ALL_HOTENDS, MPC_FAN_0_ACTIVE_HOTEND) ? 0 : active_extruder, 0);
+              planner.sync_fan_speeds(fan_speed);
+            #endif
+
+            do_z_clearance(MPC_TUNING_END_Z);
+          }
         #endif
-
-        do_z_clearance(MPC_TUNING_END_Z);
       }
-    } on_exit;
+    } on_exit = { heater, is_hotend };
 
     SERIAL_ECHOPGM(STR_MPC_AUTOTUNE);
-    SERIAL_ECHOLNPGM(STR_MPC_AUTOTUNE_START, active_extruder);
-    MPCHeaterInfo &hotend = temp_hotend[active_extruder];
-    MPC_t &constants = hotend.constants;
+    SERIAL_ECHOPGM(STR_MPC_AUTOTUNE_START);
+    switch (hid) {
+      case H_BED:     SERIAL_ECHOLNPGM("bed"); break;
+      case H_CHAMBER: SERIAL_ECHOLNPGM("chamber"); break;
+      default:        SERIAL_ECHOLNPGM(STR_E, active_extruder); break;
+    }
 
-    // Move to center of bed, just above bed height and cool with max fan
-    gcode.home_all_axes(true);
     disable_all_heaters();
-    #if HAS_FAN
-      zero_fan_speeds();
-      set_fan_speed(EITHER(MPC_FAN_0_ALL_HOTENDS, MPC_FAN_0_ACTIVE_HOTEND) ? 0 : active_extruder, 255);
-      planner.sync_fan_speeds(fan_speed);
+
+    #if ENABLED(MPCTEMP)
+      // Move to center of bed, just above bed height and cool with max fan
+      if (is_hotend) {
+        gcode.home_all_axes(true);
+        #if HAS_FAN
+          zero_fan_speeds();
+          set_fan_speed(EITHER(MPC_FAN_0_ALL_HOTENDS, MPC_FAN_0_ACTIVE_HOTEND) ? 0 : active_extruder, 255);
+          planner.sync_fan_speeds(fan_speed);
+        #endif
+        const xyz_pos_t tuningpos = MPC_TUNING_POS;
+        do_blocking_move_to(tuningpos);
+      }
     #endif
-    const xyz_pos_t tuningpos = MPC_TUNING_POS;
-    do_blocking_move_to(tuningpos);
 
     SERIAL_ECHOLNPGM(STR_MPC_COOLING_TO_AMBIENT);
     LCD_MESSAGE(MSG_COOLING);
-    millis_t ms = millis(), next_report_ms = ms, next_test_ms = ms + 10000UL;
-    celsius_float_t current_temp = degHotend(active_extruder),
+    const millis_t cool_interval = 10000UL * time_scale;
+    millis_t ms = millis(), next_report_ms = ms, next_test_ms = ms + cool_interval;
+    celsius_float_t current_temp = heater.celsius,
                     ambient_temp = current_temp;
 
     wait_for_heatup = true;
@@ -944,22 +1277,25 @@ volatile bool Temperature::raw_temps_ready = false;
           break;
         }
         ambient_temp = current_temp;
-        next_test_ms += 10000UL;
+        next_test_ms += cool_interval;
       }
     }
 
-    #if HAS_FAN
-      set_fan_speed(EITHER(MPC_FAN_0_ALL_HOTENDS, MPC_FAN_0_ACTIVE_HOTEND) ? 0 : active_extruder, 0);
-      planner.sync_fan_speeds(fan_speed);
+    #if BOTH(MPCTEMP, HAS_FAN)
+      if (is_hotend) {
+        set_fan_speed(EITHER(MPC_FAN_0_ALL_HOTENDS, MPC_FAN_0_ACTIVE_HOTEND) ? 0 : active_extruder, 0);
+        planner.sync_fan_speeds(fan_speed);
+      }
     #endif
 
-    hotend.modeled_ambient_temp = ambient_temp;
+    heater.modeled_ambient_temp = ambient_temp;
 
-    SERIAL_ECHOLNPGM(STR_MPC_HEATING_PAST_200);
+    SERIAL_ECHOLNPGM(STR_MPC_HEATING_PAST, tuning_temp, "C");
     LCD_MESSAGE(MSG_HEATING);
-    hotend.target = 200.0f;   // So M105 looks nice
-    hotend.soft_pwm_amount = MPC_MAX >> 1;
+    heater.target = tuning_temp;   // So M105 looks nice
+    heater.soft_pwm_amount = max_power >> 1;
     const millis_t heat_start_time = next_test_ms = ms;
+    const celsius_float_t sample_start_temp = is_hotend ? tuning_temp / 2.0f : (ambient_temp + tuning_temp) / 2.0f;
     celsius_float_t temp_samples[16];
     uint8_t sample_count = 0;
     uint16_t sample_distance = 1;
@@ -969,8 +1305,8 @@ volatile bool Temperature::raw_temps_ready = false;
       if (!housekeeping(ms, current_temp, next_report_ms)) return;
 
       if (ELAPSED(ms, next_test_ms)) {
-        // Record samples between 100C and 200C
-        if (current_temp >= 100.0f) {
+        // Record samples over the upper part of the heating curve
+        if (current_temp >= sample_start_temp) {
           // If there are too many samples, space them more widely
           if (sample_count == COUNT(temp_samples)) {
             for (uint8_t i = 0; i < COUNT(temp_samples) / 2; i++)
@@ -983,12 +1319,12 @@ volatile bool Temperature::raw_temps_ready = false;
           temp_samples[sample_count++] = current_temp;
         }
 
-        if (current_temp >= 200.0f) break;
+        if (current_temp >= tuning_temp) break;
 
         next_test_ms += 1000UL * sample_distance;
       }
     }
-    hotend.soft_pwm_amount = 0;
+    heater.soft_pwm_amount = 0;
 
     // Calculate physical constants from three equally-spaced samples
     sample_count = (sample_count + 1) / 2 * 2 - 1;
@@ -998,20 +1334,20 @@ volatile bool Temperature::raw_temps_ready = false;
     float asymp_temp = (t2 * t2 - t1 * t3) / (2 * t2 - t1 - t3),
           block_responsiveness = -log((t2 - asymp_temp) / (t1 - asymp_temp)) / (sample_distance * (sample_count >> 1));
 
-    constants.ambient_xfer_coeff_fan0 = constants.heater_power * (MPC_MAX) / 255 / (asymp_temp - ambient_temp);
-    constants.fan255_adjustment = 0.0f;
+    constants.ambient_xfer_coeff_fan0 = constants.heater_power * max_power / 255 / (asymp_temp - ambient_temp);
+    TERN_(MPC_INCLUDE_FAN, constants.fan255_adjustment = 0.0f);
     constants.block_heat_capacity = constants.ambient_xfer_coeff_fan0 / block_responsiveness;
     constants.sensor_responsiveness = block_responsiveness / (1.0f - (ambient_temp - asymp_temp) * exp(-block_responsiveness * t1_time) / (t1 - asymp_temp));
 
-    hotend.modeled_block_temp = asymp_temp + (ambient_temp - asymp_temp) * exp(-block_responsiveness * (ms - heat_start_time) / 1000.0f);
-    hotend.modeled_sensor_temp = current_temp;
+    heater.modeled_block_temp = asymp_temp + (ambient_temp - asymp_temp) * exp(-block_responsiveness * (ms - heat_start_time) / 1000.0f);
+    heater.modeled_sensor_temp = current_temp;
 
     // Allow the system to stabilize under MPC, then get a better measure of ambient loss with and without fan
-    SERIAL_ECHOLNPGM(STR_MPC_MEASURING_AMBIENT, hotend.modeled_block_temp);
+    SERIAL_ECHOLNPGM(STR_MPC_MEASURING_AMBIENT, heater.modeled_block_temp);
     LCD_MESSAGE(MSG_MPC_MEASURING_AMBIENT);
-    hotend.target = hotend.modeled_block_temp;
+    heater.target = heater.modeled_block_temp;
     next_test_ms = ms + MPC_dT * 1000;
-    constexpr millis_t settle_time = 20000UL, test_duration = 20000UL;
+    const millis_t settle_time = 20000UL * time_scale, test_duration = 20000UL * time_scale;
     millis_t settle_end_ms = ms + settle_time,
              test_end_ms = settle_end_ms + test_duration;
     float total_energy_fan0 = 0.0f;
@@ -1025,12 +1361,12 @@ volatile bool Temperature::raw_temps_ready = false;
       if (!housekeeping(ms, current_temp, next_report_ms)) return;
 
       if (ELAPSED(ms, next_test_ms)) {
-        hotend.soft_pwm_amount = (int)get_pid_output_hotend(active_extruder) >> 1;
+        heater.set_output(get_output());
 
         if (ELAPSED(ms, settle_end_ms) && !ELAPSED(ms, test_end_ms) && TERN1(HAS_FAN, !fan0_done))
-          total_energy_fan0 += constants.heater_power * hotend.soft_pwm_amount / 127 * MPC_dT + (last_temp - current_temp) * constants.block_heat_capacity;
+          total_energy_fan0 += constants.heater_power * heater.soft_pwm_amount / 127 * MPC_dT + (last_temp - current_temp) * constants.block_heat_capacity;
         #if HAS_FAN
-          else if (ELAPSED(ms, test_end_ms) && !fan0_done) {
+          else if (is_hotend && ELAPSED(ms, test_end_ms) && !fan0_done) {
             set_fan_speed(EITHER(MPC_FAN_0_ALL_HOTENDS, MPC_FAN_0_ACTIVE_HOTEND) ? 0 : active_extruder, 255);
             planner.sync_fan_speeds(fan_speed);
             settle_end_ms = ms + settle_time;
@@ -1038,7 +1374,7 @@ volatile bool Temperature::raw_temps_ready = false;
             fan0_done = true;
           }
           else if (ELAPSED(ms, settle_end_ms) && !ELAPSED(ms, test_end_ms))
-            total_energy_fan255 += constants.heater_power * hotend.soft_pwm_amount / 127 * MPC_dT + (last_temp - current_temp) * constants.block_heat_capacity;
+            total_energy_fan255 += constants.heater_power * heater.soft_pwm_amount / 127 * MPC_dT + (last_temp - current_temp) * constants.block_heat_capacity;
         #endif
         else if (ELAPSED(ms, test_end_ms)) break;
 
@@ -1046,23 +1382,25 @@ volatile bool Temperature::raw_temps_ready = false;
         next_test_ms += MPC_dT * 1000;
       }
 
-      if (!WITHIN(current_temp, t3 - 15.0f, hotend.target + 15.0f)) {
+      if (!WITHIN(current_temp, t3 - 15.0f, heater.target + 15.0f)) {
         SERIAL_ECHOLNPGM(STR_MPC_TEMPERATURE_ERROR);
         break;
       }
     }
 
     const float power_fan0 = total_energy_fan0 * 1000 / test_duration;
-    constants.ambient_xfer_coeff_fan0 = power_fan0 / (hotend.target - ambient_temp);
+    constants.ambient_xfer_coeff_fan0 = power_fan0 / (heater.target - ambient_temp);
 
     #if HAS_FAN
       const float power_fan255 = total_energy_fan255 * 1000 / test_duration,
-                  ambient_xfer_coeff_fan255 = power_fan255 / (hotend.target - ambient_temp);
-      constants.fan255_adjustment = ambient_xfer_coeff_fan255 - constants.ambient_xfer_coeff_fan0;
+                  ambient_xfer_coeff_fan255 = power_fan255 / (heater.target - ambient_temp);
+      #if ENABLED(MPC_INCLUDE_FAN)
+        if (is_hotend) constants.fan255_adjustment = ambient_xfer_coeff_fan255 - constants.ambient_xfer_coeff_fan0;
+      #endif
     #endif
 
     // Calculate a new and better asymptotic temperature and re-evaluate the other constants
-    asymp_temp = ambient_temp + constants.heater_power * (MPC_MAX) / 255 / constants.ambient_xfer_coeff_fan0;
+    asymp_temp = ambient_temp + constants.heater_power * max_power / 255 / constants.ambient_xfer_coeff_fan0;
     block_responsiveness = -log((t2 - asymp_temp) / (t1 - asymp_temp)) / (sample_distance * (sample_count >> 1));
     constants.block_heat_capacity = constants.ambient_xfer_coeff_fan0 / block_responsiveness;
     constants.sensor_responsiveness = block_responsiveness / (1.0f - (ambient_temp - asymp_temp) * exp(-block_responsiveness * t1_time) / (t1 - asymp_temp));
@@ -1080,27 +1418,89 @@ volatile bool Temperature::raw_temps_ready = false;
       SERIAL_ECHOLNPGM("asymp_temp ", asymp_temp);
       SERIAL_ECHOLNPAIR_F("block_responsiveness ", block_responsiveness, 4);
     //*/
-    SERIAL_ECHOLNPGM("MPC_BLOCK_HEAT_CAPACITY ", constants.block_heat_capacity);
-    SERIAL_ECHOLNPAIR_F("MPC_SENSOR_RESPONSIVENESS ", constants.sensor_responsiveness, 4);
-    SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF ", constants.ambient_xfer_coeff_fan0, 4);
-    TERN_(HAS_FAN, SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF_FAN255 ", ambient_xfer_coeff_fan255, 4));
+    SERIAL_ECHOPGM("MPC_"); SERIAL_ECHOF(name); SERIAL_ECHOLNPGM("BLOCK_HEAT_CAPACITY ", constants.block_heat_capacity);
+    SERIAL_ECHOPGM("MPC_"); SERIAL_ECHOF(name); SERIAL_ECHOLNPAIR_F("SENSOR_RESPONSIVENESS ", constants.sensor_responsiveness, 4);
+    SERIAL_ECHOPGM("MPC_"); SERIAL_ECHOF(name); SERIAL_ECHOLNPAIR_F("AMBIENT_XFER_COEFF ", constants.ambient_xfer_coeff_fan0, 4);
+    #if HAS_FAN
+      if (is_hotend) SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF_FAN255 ", ambient_xfer_coeff_fan255, 4);
+    #endif
+  }
+
+  /**
+   * Step the model of an MPC heater by MPC_dT and return the output (0-255)
+   * that will bring the modeled block to the target in about 2 seconds.
+   * With 'correct_ambient' false the caller provides modeled_ambient_temp.
+   */
+  static float MPC_output(MPCHeaterInfo &heater, const_float_t ambient_xfer_coeff, const bool active, const uint8_t max_power, const bool correct_ambient=true) {
+    MPC_t &constants = heater.constants;
+
+    // At startup, initialize modeled temperatures
+    if (isnan(heater.modeled_block_temp)) {
+      if (correct_ambient) heater.modeled_ambient_temp = _MIN(30.0f, heater.celsius);   // Cap initial value at reasonable max room temperature of 30C
+      heater.modeled_block_temp = heater.modeled_sensor_temp = heater.celsius;
+    }
+
+    // Update the modeled temperatures
+    float blocktempdelta = heater.pwm_duty() * constants.heater_power * (MPC_dT / 127) / constants.block_heat_capacity;
+    blocktempdelta += (heater.modeled_ambient_temp - heater.modeled_block_temp) * ambient_xfer_coeff * MPC_dT / constants.block_heat_capacity;
+    heater.modeled_block_temp += blocktempdelta;
+
+    const float sensortempdelta = (heater.modeled_block_temp - heater.modeled_sensor_temp) * (constants.sensor_responsiveness * MPC_dT);
+    heater.modeled_sensor_temp += sensortempdelta;
+
+    // Any delta between heater.modeled_sensor_temp and heater.celsius is either model
+    // error diverging slowly or (fast) noise. Slowly correct towards this temperature and noise will average out.
+    const float delta_to_apply = (heater.celsius - heater.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
+    heater.modeled_block_temp += delta_to_apply;
+    heater.modeled_sensor_temp += delta_to_apply;
+
+    // Only correct ambient when close to steady state (output power is not clipped or asymptotic temperature is reached)
+    if (correct_ambient && (WITHIN(heater.pwm_duty(), 1, (max_power >> 1) - 1) || fabs(blocktempdelta + delta_to_apply) < (MPC_STEADYSTATE * MPC_dT)))
+      heater.modeled_ambient_temp += delta_to_apply > 0.f ? _MAX(delta_to_apply, MPC_MIN_AMBIENT_CHANGE * MPC_dT) : _MIN(delta_to_apply, -MPC_MIN_AMBIENT_CHANGE * MPC_dT);
+
+    float power = 0.0;
+    if (active) {
+      // Plan power level to get to target temperature in 2 seconds
+      power = (heater.target - heater.modeled_block_temp) * constants.block_heat_capacity / 2.0f;
+      power -= (heater.modeled_ambient_temp - heater.modeled_block_temp) * ambient_xfer_coeff;
+    }
+
+    float output = power * 254.0f / constants.heater_power + 1.0f;   // Ensure correct quantization into a range of 0 to 127
+    output = constrain(output, 0, max_power);
+
+    /* <-- add a slash to enable
+      static uint32_t nexttime = millis() + 1000;
+      if (ELAPSED(millis(), nexttime)) {
+        nexttime += 1000;
+        SERIAL_ECHOLNPGM("block temp ", heater.modeled_block_temp,
+                         ", celsius ", heater.celsius,
+                         ", blocktempdelta ", blocktempdelta,
+                         ", delta_to_apply ", delta_to_apply,
+                         ", ambient ", heater.modeled_ambient_temp,
+                         ", power ", power,
+                         ", output ", output,
+                         ", pwm ", (int)output >> 1);
+      }
+    //*/
+
+    return output;
   }
 
-#endif // MPCTEMP
+#endif // HAS_MPC
 
 int16_t Temperature::getHeaterPower(const heater_id_t heater_id) {
   switch (heater_id) {
     #if HAS_HEATED_BED
-      case H_BED: return temp_bed.soft_pwm_amount;
+      case H_BED: return temp_bed.pwm_duty();
     #endif
     #if HAS_HEATED_CHAMBER
-      case H_CHAMBER: return temp_chamber.soft_pwm_amount;
+      case H_CHAMBER: return temp_chamber.pwm_duty();
     #endif
     #if HAS_COOLER
       case H_COOLER: return temp_cooler.soft_pwm_amount;
     #endif
     default:
-      return TERN0(HAS_HOTEND, temp_hotend[heater_id].soft_pwm_amount);
+      return TERN0(HAS_HOTEND, temp_hotend[heater_id].pwm_duty());
   }
 }
 
@@ -1250,6 +1650,8 @@ void Temperature::_temp_error(const heater_id_t heater_id, FSTR_P const serial_m
 
   static uint8_t killed = 0;
 
+  TERN_(TEMP_TELEMETRY_DUMP_ON_ERROR, bool dump = false);
+
   if (IsRunning() && TERN1(BOGUS_TEMPERATURE_GRACE_PERIOD, killed == 2)) {
     SERIAL_ERROR_START();
     SERIAL_ECHOF(serial_msg);
@@ -1275,11 +1677,17 @@ void Temperature::_temp_error(const heater_id_t heater_id, FSTR_P const serial_m
           SERIAL_ECHOLNPGM("E", real_heater_id);
     }
     SERIAL_EOL();
+    TERN_(TEMP_TELEMETRY_DUMP_ON_ERROR, dump = true);
   }
 
   disable_all_heaters(); // always disable (even for bogus temp)
   hal.watchdog_refresh();
 
+  #if ENABLED(TEMP_TELEMETRY_DUMP_ON_ERROR)
+    // Send the history only once the heaters are off, since it takes a while
+    if (dump) { temp_telemetry.report(); hal.watchdog_refresh(); }
+  #endif
+
   #if BOGUS_TEMPERATURE_GRACE_PERIOD
     const millis_t ms = millis();
     static millis_t expire_ms;
@@ -1359,7 +1767,11 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         }
 
         const float max_power_over_i_gain = float(MAX_POW) / tempinfo.pid.Ki - float(MIN_POW);
-        temp_iState = constrain(temp_iState + pid_error, 0, max_power_over_i_gain);
+        #if ENABLED(HEATER_POWER_BUDGET)
+          // Don't wind up while the power budget grants less than the last output
+          if (pid_error < 0 || !tempinfo.budget_limited())
+        #endif
+            temp_iState = constrain(temp_iState + pid_error, 0, max_power_over_i_gain);
 
         work_pid.Kp = tempinfo.pid.Kp * pid_error;
         work_pid.Ki = tempinfo.pid.Ki * temp_iState;
@@ -1404,7 +1816,16 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         REPEAT(HOTENDS, _HOTENDPID)
       };
 
-      const float pid_output = hotend_pid[ee].get_pid_output();
+      float pid_output = hotend_pid[ee].get_pid_output();
+
+      #if ENABLED(HOTEND_FEEDFORWARD)
+        // Add the power to heat the filament about to be extruded
+        if (temp_hotend[ee].target && TERN1(HEATER_IDLE_HANDLER, !heater_idle[ee].timed_out)) {
+          const float ff_watts = planner.upcoming_flow(ee, FEEDFORWARD_LOOKAHEAD_MS) * (FEEDFORWARD_FILAMENT_HEAT)
+                               * (temp_hotend[ee].target - (FEEDFORWARD_AMBIENT_TEMP));
+          if (ff_watts > 0) pid_output = _MIN(pid_output + ff_watts * (PID_MAX) / (HOTEND_HEATER_WATTS), PID_MAX);
+        }
+      #endif
 
       #if ENABLED(PID_DEBUG)
         if (ee == active_extruder)
@@ -1416,12 +1837,6 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       MPCHeaterInfo &hotend = temp_hotend[ee];
       MPC_t &constants = hotend.constants;
 
-      // At startup, initialize modeled temperatures
-      if (isnan(hotend.modeled_block_temp)) {
-        hotend.modeled_ambient_temp = min(30.0f, hotend.celsius);   // Cap initial value at reasonable max room temperature of 30C
-        hotend.modeled_block_temp = hotend.modeled_sensor_temp = hotend.celsius;
-      }
-
       #if HOTENDS == 1
         constexpr bool this_hotend = true;
       #else
@@ -1435,6 +1850,9 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         ambient_xfer_coeff += fan_fraction * constants.fan255_adjustment;
       #endif
 
+      #if ENABLED(HOTEND_FEEDFORWARD)
+        float e_speed_now = 0;  // Extrusion already included in the model
+      #endif
       if (this_hotend) {
         const int32_t e_position = stepper.position(E_AXIS);
         const float e_speed = (e_position - mpc_e_position) * planner.mm_per_step[E_AXIS] / MPC_dT;
@@ -1445,51 +1863,24 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         else if (e_speed > 0.0f) {  // Ignore retract/recover moves
           ambient_xfer_coeff += e_speed * constants.filament_heat_capacity_permm;
           mpc_e_position = e_position;
+          TERN_(HOTEND_FEEDFORWARD, e_speed_now = e_speed);
         }
       }
 
-      // Update the modeled temperatures
-      float blocktempdelta = hotend.soft_pwm_amount * constants.heater_power * (MPC_dT / 127) / constants.block_heat_capacity;
-      blocktempdelta += (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff * MPC_dT / constants.block_heat_capacity;
-      hotend.modeled_block_temp += blocktempdelta;
-
-      const float sensortempdelta = (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * (constants.sensor_responsiveness * MPC_dT);
-      hotend.modeled_sensor_temp += sensortempdelta;
-
-      // Any delta between hotend.modeled_sensor_temp and hotend.celsius is either model
-      // error diverging slowly or (fast) noise. Slowly correct towards this temperature and noise will average out.
-      const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
-      hotend.modeled_block_temp += delta_to_apply;
-      hotend.modeled_sensor_temp += delta_to_apply;
-
-      // Only correct ambient when close to steady state (output power is not clipped or asymptotic temperature is reached)
-      if (WITHIN(hotend.soft_pwm_amount, 1, 126) || fabs(blocktempdelta + delta_to_apply) < (MPC_STEADYSTATE * MPC_dT))
-        hotend.modeled_ambient_temp += delta_to_apply > 0.f ? max(delta_to_apply, MPC_MIN_AMBIENT_CHANGE * MPC_dT) : min(delta_to_apply, -MPC_MIN_AMBIENT_CHANGE * MPC_dT);
-
-      float power = 0.0;
-      if (hotend.target != 0 && TERN1(HEATER_IDLE_HANDLER, !heater_idle[ee].timed_out)) {
-        // Plan power level to get to target temperature in 2 seconds
-        power = (hotend.target - hotend.modeled_block_temp) * constants.block_heat_capacity / 2.0f;
-        power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff;
-      }
-
-      float pid_output = power * 254.0f / constants.heater_power + 1.0f;        // Ensure correct quantization into a range of 0 to 127
-      pid_output = constrain(pid_output, 0, MPC_MAX);
-
-      /* <-- add a slash to enable
-        static uint32_t nexttime = millis() + 1000;
-        if (ELAPSED(millis(), nexttime)) {
-          nexttime += 1000;
-          SERIAL_ECHOLNPGM("block temp ", hotend.modeled_block_temp,
-                           ", celsius ", hotend.celsius,
-                           ", blocktempdelta ", blocktempdelta,
-                           ", delta_to_apply ", delta_to_apply,
-                           ", ambient ", hotend.modeled_ambient_temp,
-                           ", power ", power,
-                           ", pid_output ", pid_output,
-                           ", pwm ", (int)pid_output >> 1);
+      const bool active = hotend.target != 0 && TERN1(HEATER_IDLE_HANDLER, !heater_idle[ee].timed_out);
+      float pid_output = MPC_output(hotend, ambient_xfer_coeff, active, MPC_MAX);
+
+      #if ENABLED(HOTEND_FEEDFORWARD)
+        // Add the power for planned extrusion above the current rate
+        if (active) {
+          const float ff_e_speed = planner.upcoming_flow(ee, FEEDFORWARD_LOOKAHEAD_MS) / planner.filament_area(ee);
+          if (ff_e_speed > e_speed_now) {
+            const float ff_watts = (ff_e_speed - e_speed_now) * constants.filament_heat_capacity_permm
+                                 * (hotend.target - hotend.modeled_ambient_temp);
+            if (ff_watts > 0) pid_output = _MIN(pid_output + ff_watts * (MPC_MAX) / constants.heater_power, MPC_MAX);
+          }
         }
-      //*/
+      #endif
 
     #else // No PID or MPC enabled
 
@@ -1512,7 +1903,16 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
     return pid_output;
   }
 
-#endif // PIDTEMPBED
+#elif ENABLED(MPCTEMPBED)
+
+  float Temperature::get_pid_output_bed() {
+    // Use the chamber temperature as the ambient temperature, if available
+    TERN_(HAS_TEMP_CHAMBER, temp_bed.modeled_ambient_temp = temp_chamber.celsius);
+    const bool active = temp_bed.target != 0 && TERN1(HEATER_IDLE_HANDLER, !heater_idle[IDLE_INDEX_BED].timed_out);
+    return MPC_output(temp_bed, temp_bed.constants.ambient_xfer_coeff_fan0, active, MAX_BED_POWER, DISABLED(HAS_TEMP_CHAMBER));
+  }
+
+#endif // MPCTEMPBED
 
 #if ENABLED(PIDTEMPCHAMBER)
 
@@ -1523,7 +1923,96 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
     return pid_output;
   }
 
-#endif // PIDTEMPCHAMBER
+#elif ENABLED(MPCTEMPCHAMBER)
+
+  float Temperature::get_pid_output_chamber() {
+    return MPC_output(temp_chamber, temp_chamber.constants.ambient_xfer_coeff_fan0, temp_chamber.target != 0, MAX_CHAMBER_POWER);
+  }
+
+#endif // MPCTEMPCHAMBER
+
+#if ENABLED(HEATER_POWER_BUDGET)
+
+  /**
+   * Share HEATER_POWER_LIMIT among the heaters. The heater furthest below its
+   * target gets its requested power first, and each of the others gets what is
+   * left. Heaters being autotuned in the background come before all others, so
+   * the relay gets the power it asks for. The PWM ISR never drives a heater above
+   * its soft_pwm_budget, so the total stays in budget even before a new request
+   * has been granted. This limits the average power only. The heaters all switch
+   * on at the start of each PWM period, so their on-times overlap.
+   */
+  void Temperature::manage_power_budget() {
+    constexpr uint8_t budget_heaters = HOTENDS + ENABLED(HAS_HEATED_BED) + ENABLED(HAS_HEATED_CHAMBER);
+    heater_info_t *heater[budget_heaters];
+    float watts[budget_heaters];
+    bool tuning[budget_heaters];
+    uint8_t n = 0;
+
+    #if HAS_HOTEND
+      HOTEND_LOOP() {
+        heater[n] = &temp_hotend[e];
+        tuning[n] = TERN0(PID_AUTOTUNE_CONCURRENT, PID_autotune_pwm((heater_id_t)e) >= 0);
+        watts[n++] = TERN(MPCTEMP, temp_hotend[e].constants.heater_power, HOTEND_HEATER_WATTS);
+      }
+    #endif
+    #if HAS_HEATED_BED
+      heater[n] = &temp_bed;
+      tuning[n] = TERN0(PID_AUTOTUNE_CONCURRENT, PID_autotune_pwm(H_BED) >= 0);
+      watts[n++] = TERN(MPCTEMPBED, temp_bed.constants.heater_power, BED_HEATER_WATTS);
+    #endif
+    #if HAS_HEATED_CHAMBER
+      heater[n] = &temp_chamber;
+      tuning[n] = TERN0(PID_AUTOTUNE_CONCURRENT, PID_autotune_pwm(H_CHAMBER) >= 0);
+      watts[n++] = TERN(MPCTEMPCHAMBER, temp_chamber.constants.heater_power, CHAMBER_HEATER_WATTS);
+    #endif
+
+    float remaining = HEATER_POWER_LIMIT;
+    uint16_t served = 0;
+    LOOP_L_N(i, n) {
+      // Serve a heater being tuned, or else the one furthest below its target, next
+      uint8_t h = 0;
+      float h_err = 0;
+      bool found = false;
+      LOOP_L_N(j, n) {
+        if (TEST(served, j)) continue;
+        const float err = heater[j]->target - heater[j]->celsius;
+        if (!found || tuning[j] > tuning[h] || (tuning[j] == tuning[h] && err > h_err)) { h = j; h_err = err; found = true; }
+      }
+      SBI(served, h);
+
+      uint8_t duty = heater[h]->soft_pwm_amount;
+      if (watts[h] > 0) {
+        const float allowed = _MAX(remaining, 0.0f) * 127 / watts[h];
+        if (duty > allowed) duty = allowed;
+        remaining -= watts[h] * duty / 127;
+      }
+      heater[h]->soft_pwm_budget = duty;
+      heater[h]->budget_request = heater[h]->soft_pwm_amount;
+    }
+  }
+
+#endif // HEATER_POWER_BUDGET
+
+#if ENABLED(HEATER_HARDWARE_PWM)
+
+  #define _HEATER_PWM(N,V) hal.set_pwm_duty(pin_t(HEATER_##N##_PIN), V, HEATER_PWM_MAX, HEATER_##N##_INVERTING)
+
+  /**
+   * Send the heater duty to the hardware PWM outputs. Called whenever the heaters
+   * have been managed, which is as often as soft PWM would pick up a new duty.
+   */
+  void Temperature::update_heater_pwm() {
+    #if HAS_HOTEND
+      #define _HOTEND_PWM(N) _HEATER_PWM(N, temp_hotend[N].hw_pwm_duty());
+      REPEAT(HOTENDS, _HOTEND_PWM);
+      TERN_(HEATERS_PARALLEL, _HEATER_PWM(1, temp_hotend[0].hw_pwm_duty()));
+    #endif
+    TERN_(HAS_HEATED_BED, _HEATER_PWM(BED, temp_bed.hw_pwm_duty()));
+    TERN_(HAS_HEATED_CHAMBER, _HEATER_PWM(CHAMBER, temp_chamber.hw_pwm_duty()));
+  }
+
+#endif // HEATER_HARDWARE_PWM
 
 #if HAS_HOTEND
 
@@ -1535,12 +2024,25 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 
       TERN_(HEATER_IDLE_HANDLER, heater_idle[e].update(ms));
 
+      #if ENABLED(HEATER_POWER_BUDGET)
+        // Allow more time to heat in proportion to the power the budget withheld
+        const millis_t slip = temp_hotend[e].budget_slip(ms);
+        TERN_(THERMAL_PROTECTION_HOTENDS, tr_state_machine[e].delay(slip));
+        TERN_(WATCH_HOTENDS, watch_hotend[e].delay(slip));
+      #endif
+
       #if ENABLED(THERMAL_PROTECTION_HOTENDS)
         // Check for thermal runaway
-        tr_state_machine[e].run(temp_hotend[e].celsius, temp_hotend[e].target, (heater_id_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
+        tr_state_machine[e].run(temp_hotend[e].celsius, TERN(PID_AUTOTUNE_CONCURRENT, PID_autotune_runaway_target((heater_id_t)e, temp_hotend[e].target), temp_hotend[e].target), (heater_id_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
       #endif
 
-      temp_hotend[e].soft_pwm_amount = (temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp ? (int)get_pid_output_hotend(e) >> 1 : 0;
+      #if ENABLED(PID_AUTOTUNE_CONCURRENT)
+        const int16_t tune_pwm = PID_autotune_pwm((heater_id_t)e);
+        if (tune_pwm >= 0)
+          temp_hotend[e].soft_pwm_amount = temp_hotend[e].celsius < temp_range[e].maxtemp ? tune_pwm : 0;
+        else
+      #endif
+      temp_hotend[e].set_output((temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp ? get_pid_output_hotend(e) : 0);
 
       #if WATCH_HOTENDS
         // Make sure temperature is increasing
@@ -1567,6 +2069,13 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       if (degBed() > BED_MAXTEMP) max_temp_error(H_BED);
     #endif
 
+    #if ENABLED(HEATER_POWER_BUDGET)
+      // Allow more time to heat in proportion to the power the budget withheld
+      const millis_t slip = temp_bed.budget_slip(ms);
+      TERN_(THERMAL_PROTECTION_BED, tr_state_machine[RUNAWAY_IND_BED].delay(slip));
+      TERN_(WATCH_BED, watch_bed.delay(slip));
+    #endif
+
     #if WATCH_BED
       // Make sure temperature is increasing
       if (watch_bed.elapsed(ms)) {              // Time to check the bed?
@@ -1589,7 +2098,7 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 
     do {
 
-      #if DISABLED(PIDTEMPBED)
+      #if NONE(PIDTEMPBED, MPCTEMPBED)
         if (PENDING(ms, next_bed_check_ms)
           && TERN1(PAUSE_CHANGE_REQD, paused_for_probing == last_pause_state)
         ) break;
@@ -1600,19 +2109,25 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       TERN_(HEATER_IDLE_HANDLER, heater_idle[IDLE_INDEX_BED].update(ms));
 
       #if ENABLED(THERMAL_PROTECTION_BED)
-        tr_state_machine[RUNAWAY_IND_BED].run(temp_bed.celsius, temp_bed.target, H_BED, THERMAL_PROTECTION_BED_PERIOD, THERMAL_PROTECTION_BED_HYSTERESIS);
+        tr_state_machine[RUNAWAY_IND_BED].run(temp_bed.celsius, TERN(PID_AUTOTUNE_CONCURRENT, PID_autotune_runaway_target(H_BED, temp_bed.target), temp_bed.target), H_BED, THERMAL_PROTECTION_BED_PERIOD, THERMAL_PROTECTION_BED_HYSTERESIS);
       #endif
 
       #if HEATER_IDLE_HANDLER
         if (heater_idle[IDLE_INDEX_BED].timed_out) {
           temp_bed.soft_pwm_amount = 0;
-          if (DISABLED(PIDTEMPBED)) WRITE_HEATER_BED(LOW);
+          if (NONE(PIDTEMPBED, MPCTEMPBED)) WRITE_HEATER_BED(LOW);
         }
         else
       #endif
       {
-        #if ENABLED(PIDTEMPBED)
-          temp_bed.soft_pwm_amount = WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP) ? (int)get_pid_output_bed() >> 1 : 0;
+        #if EITHER(PIDTEMPBED, MPCTEMPBED)
+          #if ENABLED(PID_AUTOTUNE_CONCURRENT)
+            const int16_t tune_pwm = PID_autotune_pwm(H_BED);
+            if (tune_pwm >= 0)
+              temp_bed.soft_pwm_amount = WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP) ? tune_pwm : 0;
+            else
+          #endif
+          temp_bed.set_output(WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP) ? get_pid_output_bed() : 0);
         #else
           // Check if temperature is within the correct band
           if (WITHIN(temp_bed.celsius, BED_MINTEMP, BED_MAXTEMP)) {
@@ -1621,7 +2136,7 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
                 temp_bed.soft_pwm_amount = 0;
               else if (temp_bed.is_below_target(-(BED_HYSTERESIS) + 1))
                 temp_bed.soft_pwm_amount = MAX_BED_POWER >> 1;
-            #else // !PIDTEMPBED && !BED_LIMIT_SWITCHING
+            #else // !PIDTEMPBED && !MPCTEMPBED && !BED_LIMIT_SWITCHING
               temp_bed.soft_pwm_amount = temp_bed.is_below_target() ? MAX_BED_POWER >> 1 : 0;
             #endif
           }
@@ -1649,6 +2164,13 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       if (degChamber() > CHAMBER_MAXTEMP) max_temp_error(H_CHAMBER);
     #endif
 
+    #if ENABLED(HEATER_POWER_BUDGET)
+      // Allow more time to heat in proportion to the power the budget withheld
+      const millis_t slip = temp_chamber.budget_slip(ms);
+      TERN_(THERMAL_PROTECTION_CHAMBER, tr_state_machine[RUNAWAY_IND_CHAMBER].delay(slip));
+      TERN_(WATCH_CHAMBER, watch_chamber.delay(slip));
+    #endif
+
     #if WATCH_CHAMBER
       // Make sure temperature is increasing
       if (watch_chamber.elapsed(ms)) {          // Time to check the chamber?
@@ -1659,7 +2181,7 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       }
     #endif
 
-    #if EITHER(CHAMBER_FAN, CHAMBER_VENT) || DISABLED(PIDTEMPCHAMBER)
+    #if EITHER(CHAMBER_FAN, CHAMBER_VENT) || NONE(PIDTEMPCHAMBER, MPCTEMPCHAMBER)
       static bool flag_chamber_excess_heat; // = false;
     #endif
 
@@ -1723,9 +2245,15 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       }
     #endif
 
-    #if ENABLED(PIDTEMPCHAMBER)
-      // PIDTEMPCHAMBER doesn't support a CHAMBER_VENT yet.
-      temp_chamber.soft_pwm_amount = WITHIN(temp_chamber.celsius, CHAMBER_MINTEMP, CHAMBER_MAXTEMP) ? (int)get_pid_output_chamber() >> 1 : 0;
+    #if EITHER(PIDTEMPCHAMBER, MPCTEMPCHAMBER)
+      // PIDTEMPCHAMBER and MPCTEMPCHAMBER don't support a CHAMBER_VENT yet.
+      #if ENABLED(PID_AUTOTUNE_CONCURRENT)
+        const int16_t tune_pwm = PID_autotune_pwm(H_CHAMBER);
+        if (tune_pwm >= 0)
+          temp_chamber.soft_pwm_amount = WITHIN(temp_chamber.celsius, CHAMBER_MINTEMP, CHAMBER_MAXTEMP) ? tune_pwm : 0;
+        else
+      #endif
+      temp_chamber.set_output(WITHIN(temp_chamber.celsius, CHAMBER_MINTEMP, CHAMBER_MAXTEMP) ? get_pid_output_chamber() : 0);
     #else
       if (ELAPSED(ms, next_chamber_check_ms)) {
         next_chamber_check_ms = ms + CHAMBER_CHECK_INTERVAL;
@@ -1757,7 +2285,7 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         }
      }
      #if ENABLED(THERMAL_PROTECTION_CHAMBER)
-       tr_state_machine[RUNAWAY_IND_CHAMBER].run(temp_chamber.celsius, temp_chamber.target, H_CHAMBER, THERMAL_PROTECTION_CHAMBER_PERIOD, THERMAL_PROTECTION_CHAMBER_HYSTERESIS);
+       tr_state_machine[RUNAWAY_IND_CHAMBER].run(temp_chamber.celsius, TERN(PID_AUTOTUNE_CONCURRENT, PID_autotune_runaway_target(H_CHAMBER, temp_chamber.target), temp_chamber.target), H_CHAMBER, THERMAL_PROTECTION_CHAMBER_PERIOD, THERMAL_PROTECTION_CHAMBER_HYSTERESIS);
      #endif
    #endif
   }
@@ -1874,6 +2402,9 @@ void Temperature::task() {
 
   const millis_t ms = millis();
 
+  // Step background PID autotune jobs before the heaters are managed
+  TERN_(PID_AUTOTUNE_CONCURRENT, PID_autotune_task(ms));
+
   // Handle Hotend Temp Errors, Heating Watch, etc.
   TERN_(HAS_HOTEND, manage_hotends(ms));
 
@@ -1898,6 +2429,12 @@ void Temperature::task() {
   // Handle Heated Chamber Temp Errors, Heating Watch, etc.
   TERN_(HAS_HEATED_CHAMBER, manage_heated_chamber(ms));
 
+  // Share the power supply among the heaters
+  TERN_(HEATER_POWER_BUDGET, manage_power_budget());
+
+  // Apply the new duty to hardware PWM heaters
+  TERN_(HEATER_HARDWARE_PWM, update_heater_pwm());
+
   // Handle Cooler Temp Errors, Cooling Watch, etc.
   TERN_(HAS_COOLER, manage_cooler(ms));
 
@@ -1918,78 +2455,105 @@ void Temperature::task() {
 #define TEMP_AD595(RAW)  ((RAW) * 5.0 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD595_GAIN) + TEMP_SENSOR_AD595_OFFSET)
 #define TEMP_AD8495(RAW) ((RAW) * 6.6 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD8495_GAIN) + TEMP_SENSOR_AD8495_OFFSET)
 
+// Bits in the raw value range (e.g., 14 for a 10-bit ADC with 16x oversampling)
+constexpr uint8_t tt_log2(const uint32_t n) { return n > 1 ? 1 + tt_log2(n >> 1) : 0; }
+constexpr uint8_t tt_raw_bits = tt_log2(uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1);
+
+// Index sequence used to build tables at compile time
+template<uint16_t...> struct tt_seq {};
+template<uint16_t N, uint16_t... I> struct tt_make_seq : tt_make_seq<N - 1, N - 1, I...> {};
+template<uint16_t... I> struct tt_make_seq<0, I...> { typedef tt_seq<I...> type; };
+
+#define TT_INDEX_BITS 7   // 128 buckets over the raw range
+#define TT_INDEX_SHIFT (tt_raw_bits - (TT_INDEX_BITS))
+static_assert(tt_raw_bits >= 8, "The raw thermistor range needs at least 8 bits.");
+
+// Count the entries below a raw value. Table values are in ascending order.
+constexpr uint8_t tt_count_below(const temp_entry_t *tbl, const uint8_t len, const uint32_t raw) {
+  return len ? (tbl[len - 1].value < raw) + tt_count_below(tbl, len - 1, raw) : 0;
+}
+constexpr bool tt_ascending(const temp_entry_t *tbl, const uint8_t len) {
+  return len < 2 || (tbl[len - 2].value <= tbl[len - 1].value && tt_ascending(tbl, len - 1));
+}
+
 /**
- * Bisect search for the range of the 'raw' value, then interpolate
- * proportionally between the under and over values.
+ * Convert with a thermistor table. An index built at compile time splits the raw
+ * range into uniform buckets, each giving the first table entry in the bucket.
+ * Step from there to the entry over 'raw' (rarely more than a couple of entries)
+ * then interpolate proportionally between the under and over values.
  */
-#define SCAN_THERMISTOR_TABLE(TBL,LEN) do{                                \
-  uint8_t l = 0, r = LEN, m;                                              \
-  for (;;) {                                                              \
-    m = (l + r) >> 1;                                                     \
-    if (!m) return celsius_t(pgm_read_word(&TBL[0].celsius));             \
-    if (m == l || m == r) return celsius_t(pgm_read_word(&TBL[LEN-1].celsius)); \
-    raw_adc_t v00 = pgm_read_word(&TBL[m-1].value),                       \
-              v10 = pgm_read_word(&TBL[m-0].value);                       \
-         if (raw < v00) r = m;                                            \
-    else if (raw > v10) l = m;                                            \
-    else {                                                                \
-      const celsius_t v01 = celsius_t(pgm_read_word(&TBL[m-1].celsius)),  \
-                      v11 = celsius_t(pgm_read_word(&TBL[m-0].celsius));  \
-      return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);     \
-    }                                                                     \
-  }                                                                       \
-}while(0)
+template<const temp_entry_t *TBL, uint8_t LEN, uint16_t... B>
+celsius_float_t thermistor_table_lookup(const raw_adc_t raw, tt_seq<B...>) {
+  static_assert(tt_ascending(TBL, LEN), "Thermistor table values must be in ascending order.");
+  static constexpr uint8_t index[] PROGMEM = { tt_count_below(TBL, LEN, uint32_t(B) << TT_INDEX_SHIFT)... };
+
+  uint8_t m = pgm_read_byte(&index[raw >> TT_INDEX_SHIFT]);
+  while (m < LEN && raw > raw_adc_t(pgm_read_word(&TBL[m].value))) m++;
+
+  if (m == 0) return celsius_t(pgm_read_word(&TBL[0].celsius));
+  if (m == LEN) return celsius_t(pgm_read_word(&TBL[LEN - 1].celsius));
+
+  const raw_adc_t v00 = pgm_read_word(&TBL[m - 1].value),
+                  v10 = pgm_read_word(&TBL[m - 0].value);
+  const celsius_t v01 = celsius_t(pgm_read_word(&TBL[m - 1].celsius)),
+                  v11 = celsius_t(pgm_read_word(&TBL[m - 0].celsius));
+  return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);
+}
+
+#define SCAN_THERMISTOR_TABLE(TBL,LEN) return thermistor_table_lookup<TBL, LEN>(raw, tt_make_seq<_BV(TT_INDEX_BITS)>::type())
 
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
 
-  void Temperature::reset_user_thermistors() {
-    user_thermistor_t default_user_thermistor[USER_THERMISTORS] = {
-      #if TEMP_SENSOR_0_IS_CUSTOM
-        { true, 0, 0, HOTEND0_PULLUP_RESISTOR_OHMS, HOTEND0_RESISTANCE_25C_OHMS, 0, 0, HOTEND0_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_1_IS_CUSTOM
-        { true, 0, 0, HOTEND1_PULLUP_RESISTOR_OHMS, HOTEND1_RESISTANCE_25C_OHMS, 0, 0, HOTEND1_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_2_IS_CUSTOM
-        { true, 0, 0, HOTEND2_PULLUP_RESISTOR_OHMS, HOTEND2_RESISTANCE_25C_OHMS, 0, 0, HOTEND2_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_3_IS_CUSTOM
-        { true, 0, 0, HOTEND3_PULLUP_RESISTOR_OHMS, HOTEND3_RESISTANCE_25C_OHMS, 0, 0, HOTEND3_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_4_IS_CUSTOM
-        { true, 0, 0, HOTEND4_PULLUP_RESISTOR_OHMS, HOTEND4_RESISTANCE_25C_OHMS, 0, 0, HOTEND4_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_5_IS_CUSTOM
-        { true, 0, 0, HOTEND5_PULLUP_RESISTOR_OHMS, HOTEND5_RESISTANCE_25C_OHMS, 0, 0, HOTEND5_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_6_IS_CUSTOM
-        { true, 0, 0, HOTEND6_PULLUP_RESISTOR_OHMS, HOTEND6_RESISTANCE_25C_OHMS, 0, 0, HOTEND6_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_7_IS_CUSTOM
-        { true, 0, 0, HOTEND7_PULLUP_RESISTOR_OHMS, HOTEND7_RESISTANCE_25C_OHMS, 0, 0, HOTEND7_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_BED_IS_CUSTOM
-        { true, 0, 0, BED_PULLUP_RESISTOR_OHMS, BED_RESISTANCE_25C_OHMS, 0, 0, BED_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_CHAMBER_IS_CUSTOM
-        { true, 0, 0, CHAMBER_PULLUP_RESISTOR_OHMS, CHAMBER_RESISTANCE_25C_OHMS, 0, 0, CHAMBER_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_COOLER_IS_CUSTOM
-        { true, 0, 0, COOLER_PULLUP_RESISTOR_OHMS, COOLER_RESISTANCE_25C_OHMS, 0, 0, COOLER_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_PROBE_IS_CUSTOM
-        { true, 0, 0, PROBE_PULLUP_RESISTOR_OHMS, PROBE_RESISTANCE_25C_OHMS, 0, 0, PROBE_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_BOARD_IS_CUSTOM
-        { true, 0, 0, BOARD_PULLUP_RESISTOR_OHMS, BOARD_RESISTANCE_25C_OHMS, 0, 0, BOARD_BETA, 0 },
-      #endif
-      #if TEMP_SENSOR_REDUNDANT_IS_CUSTOM
-        { true, 0, 0, REDUNDANT_PULLUP_RESISTOR_OHMS, REDUNDANT_RESISTANCE_25C_OHMS, 0, 0, REDUNDANT_BETA, 0 },
-      #endif
+  // Default parameters, also used to build the tables below
+  static constexpr user_thermistor_t user_thermistor_defaults[USER_THERMISTORS] PROGMEM = {
+    #if TEMP_SENSOR_0_IS_CUSTOM
+      { true, 0, 0, HOTEND0_PULLUP_RESISTOR_OHMS, HOTEND0_RESISTANCE_25C_OHMS, 0, 0, HOTEND0_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_1_IS_CUSTOM
+      { true, 0, 0, HOTEND1_PULLUP_RESISTOR_OHMS, HOTEND1_RESISTANCE_25C_OHMS, 0, 0, HOTEND1_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_2_IS_CUSTOM
+      { true, 0, 0, HOTEND2_PULLUP_RESISTOR_OHMS, HOTEND2_RESISTANCE_25C_OHMS, 0, 0, HOTEND2_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_3_IS_CUSTOM
+      { true, 0, 0, HOTEND3_PULLUP_RESISTOR_OHMS, HOTEND3_RESISTANCE_25C_OHMS, 0, 0, HOTEND3_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_4_IS_CUSTOM
+      { true, 0, 0, HOTEND4_PULLUP_RESISTOR_OHMS, HOTEND4_RESISTANCE_25C_OHMS, 0, 0, HOTEND4_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_5_IS_CUSTOM
+      { true, 0, 0, HOTEND5_PULLUP_RESISTOR_OHMS, HOTEND5_RESISTANCE_25C_OHMS, 0, 0, HOTEND5_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_6_IS_CUSTOM
+      { true, 0, 0, HOTEND6_PULLUP_RESISTOR_OHMS, HOTEND6_RESISTANCE_25C_OHMS, 0, 0, HOTEND6_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_7_IS_CUSTOM
+      { true, 0, 0, HOTEND7_PULLUP_RESISTOR_OHMS, HOTEND7_RESISTANCE_25C_OHMS, 0, 0, HOTEND7_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_BED_IS_CUSTOM
+      { true, 0, 0, BED_PULLUP_RESISTOR_OHMS, BED_RESISTANCE_25C_OHMS, 0, 0, BED_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_CHAMBER_IS_CUSTOM
+      { true, 0, 0, CHAMBER_PULLUP_RESISTOR_OHMS, CHAMBER_RESISTANCE_25C_OHMS, 0, 0, CHAMBER_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_COOLER_IS_CUSTOM
+      { true, 0, 0, COOLER_PULLUP_RESISTOR_OHMS, COOLER_RESISTANCE_25C_OHMS, 0, 0, COOLER_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_PROBE_IS_CUSTOM
+      { true, 0, 0, PROBE_PULLUP_RESISTOR_OHMS, PROBE_RESISTANCE_25C_OHMS, 0, 0, PROBE_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_BOARD_IS_CUSTOM
+      { true, 0, 0, BOARD_PULLUP_RESISTOR_OHMS, BOARD_RESISTANCE_25C_OHMS, 0, 0, BOARD_BETA, 0 },
+    #endif
+    #if TEMP_SENSOR_REDUNDANT_IS_CUSTOM
+      { true, 0, 0, REDUNDANT_PULLUP_RESISTOR_OHMS, REDUNDANT_RESISTANCE_25C_OHMS, 0, 0, REDUNDANT_BETA, 0 },
+    #endif
     };
-    COPY(user_thermistor, default_user_thermistor);
+
+  void Temperature::reset_user_thermistors() {
+    memcpy_P(user_thermistor, user_thermistor_defaults, sizeof(user_thermistor));
   }
 
   void Temperature::M305_report(const uint8_t t_index, const bool forReplay/*=true*/) {
@@ -2023,11 +2587,113 @@ void Temperature::task() {
     SERIAL_EOL();
   }
 
+  /**
+   * Tables for user thermistors with their default parameters, built at compile time
+   * with the same math as user_thermistor_to_deg_c. Values are in 1/16 °C at uniform
+   * raw steps, so a lookup is one index and one interpolation.
+   *
+   * Uniform steps are only fine where the curve is gentle. The error at the middle of
+   * every step is checked at compile time, and a part with any step off by more than
+   * UT_TABLE_MAX_ERROR between UT_TABLE_MIN_C and UT_TABLE_MAX_C gets no table. Readings
+   * outside that range, and parts without a table, use the calculation.
+   */
+  #define UT_TABLE_BITS       8   // 256 steps, within 0.2°C for a 100k β3950 part on a 4.7k pullup
+  #define UT_TABLE_SHIFT      (tt_raw_bits - (UT_TABLE_BITS))
+  #define UT_TABLE_MIN_C      0
+  #define UT_TABLE_MAX_C    300
+  #define UT_TABLE_MAX_ERROR  0.25f
+
+  // Natural log at compile time: reduce to [0.5, 2] and sum the atanh series
+  constexpr float ut_atanh_sum(const float y2, const float p, const uint8_t n) {
+    return n > 31 ? 0 : p / n + ut_atanh_sum(y2, p * y2, n + 2);
+  }
+  constexpr float ut_ln(const float x) {
+    return x > 2 ? ut_ln(x * 0.5f) + 0.69314718f
+         : x < 0.5f ? ut_ln(x * 2) - 0.69314718f
+         : 2 * ut_atanh_sum(sq((x - 1) / (x + 1)), (x - 1) / (x + 1), 1);
+  }
+
+  constexpr float ut_celsius(const user_thermistor_t &t, const float log_res, const float log_res_25) {
+    return 1.0f / (1.0f / (THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
+                    + (log_res - log_res_25) / t.beta
+                    + t.sh_c_coeff * (log_res * log_res * log_res - log_res_25 * log_res_25 * log_res_25)
+                  ) + THERMISTOR_ABS_ZERO_C;
+  }
+
+  constexpr float ut_raw_celsius(const user_thermistor_t &t, const float raw) {
+    return ut_celsius(t, ut_ln(t.series_res * (raw + 0.5f) / ((MAX_RAW_THERMISTOR_VALUE - raw) - 0.5f)), ut_ln(t.res_25));
+  }
+
+  constexpr int16_t ut_sixteenths(const float c) { return int16_t(16 * (c > 999 ? 999 : c < -2047 ? -2047 : c) + (c < 0 ? -0.5f : 0.5f)); }
+
+  constexpr int16_t ut_sample(const user_thermistor_t &t, const uint32_t raw) {
+    return raw < 1 ? ut_sample(t, 1) : raw > MAX_RAW_THERMISTOR_VALUE - 1 ? ut_sample(t, MAX_RAW_THERMISTOR_VALUE - 1)
+      : ut_sixteenths(ut_raw_celsius(t, raw));
+  }
+
+  // Interpolation error at the middle of table step i, given the true temperature there
+  constexpr float ut_step_error(const user_thermistor_t &t, const uint32_t i, const float c) {
+    return (c < UT_TABLE_MIN_C || c > UT_TABLE_MAX_C) ? 0
+      : ABS((ut_sample(t, i << UT_TABLE_SHIFT) + ut_sample(t, (i + 1) << UT_TABLE_SHIFT)) * (0.0625f / 2) - c);
+  }
+  constexpr float ut_step_error(const user_thermistor_t &t, const uint32_t i) {
+    return ut_step_error(t, i, ut_raw_celsius(t, (i << UT_TABLE_SHIFT) + (_BV(UT_TABLE_SHIFT) >> 1)));
+  }
+
+  // Largest error over count steps from first, halving the range to keep the recursion shallow
+  constexpr float ut_table_error(const user_thermistor_t &t, const uint32_t first, const uint32_t count) {
+    return count > 1 ? _MAX(ut_table_error(t, first, count >> 1), ut_table_error(t, first + (count >> 1), count - (count >> 1)))
+      : ut_step_error(t, first);
+  }
+
+  template<uint8_t I, uint16_t... S>
+  celsius_float_t user_thermistor_table_lookup(const raw_adc_t raw, tt_seq<S...>) {
+    static constexpr int16_t table[] PROGMEM = { ut_sample(user_thermistor_defaults[I], uint32_t(S) << UT_TABLE_SHIFT)... };
+    const uint16_t i = raw >> UT_TABLE_SHIFT;
+    const int16_t lo = pgm_read_word(&table[i]), hi = pgm_read_word(&table[i + 1]);
+    return (lo + (hi - lo) * float(raw & (_BV(UT_TABLE_SHIFT) - 1)) / _BV(UT_TABLE_SHIFT)) * 0.0625f;
+  }
+
+  // The table for one user thermistor, or none if it isn't accurate enough
+  template<uint8_t I, bool OK = (ut_table_error(user_thermistor_defaults[I], 0, _BV(UT_TABLE_BITS)) <= UT_TABLE_MAX_ERROR)>
+  struct UserThermistorTableFor {
+    static bool lookup(const raw_adc_t raw, celsius_float_t &c) {
+      c = user_thermistor_table_lookup<I>(raw, tt_make_seq<_BV(UT_TABLE_BITS) + 1>::type());
+      return WITHIN(c, UT_TABLE_MIN_C, UT_TABLE_MAX_C);
+    }
+  };
+  template<uint8_t I> struct UserThermistorTableFor<I, false> {
+    static bool lookup(const raw_adc_t, celsius_float_t&) { return false; }
+  };
+
+  // Pick the table for a user thermistor index. False if the calculation is needed.
+  template<uint8_t I> struct UserThermistorTable {
+    static bool lookup(const uint8_t t_index, const raw_adc_t raw, celsius_float_t &c) {
+      return t_index == I ? UserThermistorTableFor<I>::lookup(raw, c)
+                          : UserThermistorTable<I - 1>::lookup(t_index, raw, c);
+    }
+  };
+  template<> struct UserThermistorTable<0> {
+    static bool lookup(const uint8_t, const raw_adc_t raw, celsius_float_t &c) {
+      return UserThermistorTableFor<0>::lookup(raw, c);
+    }
+  };
+
   celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
 
     if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
 
     user_thermistor_t &t = user_thermistor[t_index];
+
+    // Use the table if the parameters haven't been changed with M305
+    const user_thermistor_t &d = user_thermistor_defaults[t_index];
+    if ( t.series_res == pgm_read_float(&d.series_res) && t.res_25 == pgm_read_float(&d.res_25)
+      && t.beta == pgm_read_float(&d.beta) && t.sh_c_coeff == pgm_read_float(&d.sh_c_coeff)
+    ) {
+      celsius_float_t c;
+      if (UserThermistorTable<USER_THERMISTORS - 1>::lookup(t_index, raw, c)) return c;
+    }
+
     if (t.pre_calc) { // pre-calculate some variables
       t.pre_calc     = false;
       t.res_25_recip = 1.0f / t.res_25;
@@ -2085,6 +2751,8 @@ void Temperature::task() {
           return TEMP_AD595(raw);
         #elif TEMP_SENSOR_0_IS_AD8495
           return TEMP_AD8495(raw);
+        #elif TEMP_SENSOR_0_IS_THERMISTOR
+          SCAN_THERMISTOR_TABLE(TEMPTABLE_0, TEMPTABLE_0_LEN);
         #else
           break;
         #endif
@@ -2104,6 +2772,8 @@ void Temperature::task() {
           return TEMP_AD595(raw);
         #elif TEMP_SENSOR_1_IS_AD8495
           return TEMP_AD8495(raw);
+        #elif TEMP_SENSOR_1_IS_THERMISTOR
+          SCAN_THERMISTOR_TABLE(TEMPTABLE_1, TEMPTABLE_1_LEN);
         #else
           break;
         #endif
@@ -2114,6 +2784,8 @@ void Temperature::task() {
           return TEMP_AD595(raw);
         #elif TEMP_SENSOR_2_IS_AD8495
           return TEMP_AD8495(raw);
+        #elif TEMP_SENSOR_2_IS_THERMISTOR
+          SCAN_THERMISTOR_TABLE(TEMPTABLE_2, TEMPTABLE_2_LEN);
         #else
           break;
         #endif
@@ -2124,6 +2796,8 @@ void Temperature::task() {
           return TEMP_AD595(raw);
         #elif TEMP_SENSOR_3_IS_AD8495
           return TEMP_AD8495(raw);
+        #elif TEMP_SENSOR_3_IS_THERMISTOR
+          SCAN_THERMISTOR_TABLE(TEMPTABLE_3, TEMPTABLE_3_LEN);
         #else
           break;
         #endif
@@ -2134,6 +2808,8 @@ void Temperature::task() {
           return TEMP_AD595(raw);
         #elif TEMP_SENSOR_4_IS_AD8495
           return TEMP_AD8495(raw);
+        #elif TEMP_SENSOR_4_IS_THERMISTOR
+          SCAN_THERMISTOR_TABLE(TEMPTABLE_4, TEMPTABLE_4_LEN);
         #else
           break;
         #endif
@@ -2144,6 +2820,8 @@ void Temperature::task() {
           return TEMP_AD595(raw);
         #elif TEMP_SENSOR_5_IS_AD8495
           return TEMP_AD8495(raw);
+        #elif TEMP_SENSOR_5_IS_THERMISTOR
+          SCAN_THERMISTOR_TABLE(TEMPTABLE_5, TEMPTABLE_5_LEN);
         #else
           break;
         #endif
@@ -2154,6 +2832,8 @@ void Temperature::task() {
           return TEMP_AD595(raw);
         #elif TEMP_SENSOR_6_IS_AD8495
           return TEMP_AD8495(raw);
+        #elif TEMP_SENSOR_6_IS_THERMISTOR
+          SCAN_THERMISTOR_TABLE(TEMPTABLE_6, TEMPTABLE_6_LEN);
         #else
           break;
         #endif
@@ -2164,18 +2844,14 @@ void Temperature::task() {
           return TEMP_AD595(raw);
         #elif TEMP_SENSOR_7_IS_AD8495
           return TEMP_AD8495(raw);
+        #elif TEMP_SENSOR_7_IS_THERMISTOR
+          SCAN_THERMISTOR_TABLE(TEMPTABLE_7, TEMPTABLE_7_LEN);
         #else
           break;
         #endif
       default: break;
     }
 
-    #if HAS_HOTEND_THERMISTOR
-      // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
-    #endif
-
     return 0;
   }
 #endif // HAS_HOTEND
@@ -2325,6 +3001,7 @@ void Temperature::updateTemperaturesFromRawValues() {
 
   TERN_(FILAMENT_WIDTH_SENSOR, filwidth.update_measured_mm());
   TERN_(HAS_POWER_MONITOR,     power_monitor.capture_values());
+  TERN_(TEMP_TELEMETRY,        temp_telemetry.record());
 
   #if HAS_HOTEND
     static constexpr int8_t temp_dir[] = {
@@ -2487,6 +3164,8 @@ void Temperature::init() {
   #if ENABLED(MPCTEMP)
     HOTEND_LOOP() temp_hotend[e].modeled_block_temp = NAN;
   #endif
+  TERN_(MPCTEMPBED, temp_bed.modeled_block_temp = NAN);
+  TERN_(MPCTEMPCHAMBER, temp_chamber.modeled_block_temp = NAN);
 
   #if HAS_HEATER_0
     #ifdef BOARD_OPENDRAIN_MOSFETS
@@ -2529,6 +3208,26 @@ void Temperature::init() {
     OUT_WRITE(HEATER_CHAMBER_PIN, HEATER_CHAMBER_INVERTING);
   #endif
 
+  #if ENABLED(HEATER_HARDWARE_PWM)
+    // Without a PWM channel the HAL would only switch the heater on and off, or not at all
+    bool heater_pwm_ok = true;
+    #define _HEATER_PWM_INIT(N) do{ \
+      hal.set_pwm_frequency(pin_t(HEATER_##N##_PIN), HEATER_PWM_FREQUENCY); \
+      if (!hal.attach_pwm(pin_t(HEATER_##N##_PIN))) { \
+        SERIAL_ERROR_MSG("HEATER_" #N "_PIN has no PWM channel for HEATER_HARDWARE_PWM."); \
+        heater_pwm_ok = false; \
+      } \
+    }while(0);
+    #if HAS_HOTEND
+      REPEAT(HOTENDS, _HEATER_PWM_INIT);
+      TERN_(HEATERS_PARALLEL, _HEATER_PWM_INIT(1));
+    #endif
+    TERN_(HAS_HEATED_BED, _HEATER_PWM_INIT(BED));
+    TERN_(HAS_HEATED_CHAMBER, _HEATER_PWM_INIT(CHAMBER));
+    if (!heater_pwm_ok) kill(F("Heater PWM pin"));
+    update_heater_pwm();
+  #endif
+
   #if HAS_COOLER
     OUT_WRITE(COOLER_PIN, COOLER_INVERTING);
   #endif
@@ -2872,6 +3571,7 @@ void Temperature::disable_all_heaters() {
 
   // Disable autotemp, unpause and reset everything
   TERN_(AUTOTEMP, planner.autotemp_enabled = false);
+  TERN_(PID_AUTOTUNE_CONCURRENT, PID_autotune_cancel());
   TERN_(PROBING_HEATERS_OFF, pause_heaters(false));
 
   #if HAS_HOTEND
@@ -2903,6 +3603,8 @@ void Temperature::disable_all_heaters() {
     temp_cooler.soft_pwm_amount = 0;
     WRITE_HEATER_COOLER(LOW);
   #endif
+
+  TERN_(HEATER_HARDWARE_PWM, update_heater_pwm());
 }
 
 #if ENABLED(PRINTJOB_TIMER_AUTOSTART)
@@ -3168,12 +3870,114 @@ void Temperature::update_raw_temperatures() {
   TERN_(HAS_JOY_ADC_Z, joystick.z.update());
 }
 
+#if ENABLED(ADC_SCAN_SAMPLING)
+
+  static_assert(OVERSAMPLENR >= 4, "ADC_SCAN_SAMPLING requires OVERSAMPLENR of 4 or more.");
+
+  /**
+   * ADC channels read together on each scan. The HAL keeps every channel
+   * current by DMA so there's no need for separate start and read passes.
+   */
+  typedef struct { pin_t pin; temp_info_t *info; } adc_scan_channel_t;
+
+  static const adc_scan_channel_t adc_scan_channels[] = {
+    #if HAS_TEMP_ADC_0
+      { TEMP_0_PIN, &Temperature::temp_hotend[0] },
+    #endif
+    #if HAS_TEMP_ADC_BED
+      { TEMP_BED_PIN, &Temperature::temp_bed },
+    #endif
+    #if HAS_TEMP_ADC_CHAMBER
+      { TEMP_CHAMBER_PIN, &Temperature::temp_chamber },
+    #endif
+    #if HAS_TEMP_ADC_COOLER
+      { TEMP_COOLER_PIN, &Temperature::temp_cooler },
+    #endif
+    #if HAS_TEMP_ADC_PROBE
+      { TEMP_PROBE_PIN, &Temperature::temp_probe },
+    #endif
+    #if HAS_TEMP_ADC_BOARD
+      { TEMP_BOARD_PIN, &Temperature::temp_board },
+    #endif
+    #if HAS_TEMP_ADC_REDUNDANT
+      { TEMP_REDUNDANT_PIN, &Temperature::temp_redundant },
+    #endif
+    #if HAS_TEMP_ADC_1
+      { TEMP_1_PIN, &Temperature::temp_hotend[1] },
+    #endif
+    #if HAS_TEMP_ADC_2
+      { TEMP_2_PIN, &Temperature::temp_hotend[2] },
+    #endif
+    #if HAS_TEMP_ADC_3
+      { TEMP_3_PIN, &Temperature::temp_hotend[3] },
+    #endif
+    #if HAS_TEMP_ADC_4
+      { TEMP_4_PIN, &Temperature::temp_hotend[4] },
+    #endif
+    #if HAS_TEMP_ADC_5
+      { TEMP_5_PIN, &Temperature::temp_hotend[5] },
+    #endif
+    #if HAS_TEMP_ADC_6
+      { TEMP_6_PIN, &Temperature::temp_hotend[6] },
+    #endif
+    #if HAS_TEMP_ADC_7
+      { TEMP_7_PIN, &Temperature::temp_hotend[7] },
+    #endif
+    #if HAS_JOY_ADC_X
+      { JOY_X_PIN, &joystick.x },
+    #endif
+    #if HAS_JOY_ADC_Y
+      { JOY_Y_PIN, &joystick.y },
+    #endif
+    #if HAS_JOY_ADC_Z
+      { JOY_Z_PIN, &joystick.z },
+    #endif
+  };
+
+  // The last OVERSAMPLENR readings of each channel
+  static raw_adc_t adc_scan_ring[COUNT(adc_scan_channels)][OVERSAMPLENR];
+  static uint8_t adc_scan_index; // = 0
+
+  // Read all channels into the ring. Return 'true' when the ring is full.
+  static bool adc_scan() {
+    LOOP_L_N(i, COUNT(adc_scan_channels)) {
+      hal.adc_start(adc_scan_channels[i].pin);
+      adc_scan_ring[i][adc_scan_index] = hal.adc_value();
+    }
+    if (++adc_scan_index < OVERSAMPLENR) return false;
+    adc_scan_index = 0;
+    return true;
+  }
+
+  /**
+   * Set each sensor to the sum of its ring, with the highest and lowest
+   * readings replaced by the mean of the rest to reject noise spikes.
+   */
+  static void adc_scan_filter() {
+    LOOP_L_N(i, COUNT(adc_scan_channels)) {
+      const raw_adc_t * const ring = adc_scan_ring[i];
+      uint32_t sum = 0;
+      raw_adc_t lo = ring[0], hi = ring[0];
+      LOOP_L_N(s, OVERSAMPLENR) {
+        const raw_adc_t r = ring[s];
+        sum += r; NOMORE(lo, r); NOLESS(hi, r);
+      }
+      temp_info_t &info = *adc_scan_channels[i].info;
+      info.reset();
+      info.sample(raw_adc_t((sum - lo - hi) * (OVERSAMPLENR) / ((OVERSAMPLENR) - 2)));
+    }
+  }
+
+#endif // ADC_SCAN_SAMPLING
+
 /**
  * Called by the Temperature ISR when all the ADCs have been processed.
  * Reset all the ADC accumulators for another round of updates.
  */
 void Temperature::readings_ready() {
 
+  TERN_(ADC_SCAN_SAMPLING, adc_scan_filter());
+
   // Update raw values only if they're not already set.
   if (!raw_temps_ready) {
     update_raw_temperatures();
@@ -3267,8 +4071,6 @@ void Temperature::isr() {
     }
   #endif
 
-  static int8_t temp_count = -1;
-  static ADCSensorState adc_sensor_state = StartupDelay;
   static uint8_t pwm_count = _BV(SOFT_PWM_SCALE);
 
   // Avoid multiple loads of pwm_count
@@ -3279,15 +4081,16 @@ void Temperature::isr() {
     static bool ADCKey_pressed = false;
   #endif
 
-  #if HAS_HOTEND
+  // Hardware PWM heaters are set by update_heater_pwm() instead
+  #if HAS_HOTEND && DISABLED(HEATER_HARDWARE_PWM)
     static SoftPWM soft_pwm_hotend[HOTENDS];
   #endif
 
-  #if HAS_HEATED_BED
+  #if HAS_HEATED_BED && DISABLED(HEATER_HARDWARE_PWM)
     static SoftPWM soft_pwm_bed;
   #endif
 
-  #if HAS_HEATED_CHAMBER
+  #if HAS_HEATED_CHAMBER && DISABLED(HEATER_HARDWARE_PWM)
     static SoftPWM soft_pwm_chamber;
   #endif
 
@@ -3303,11 +4106,11 @@ void Temperature::isr() {
 
   #if DISABLED(SLOW_PWM_HEATERS)
 
-    #if ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER, HAS_COOLER, FAN_SOFT_PWM)
+    #if ANY(HAS_COOLER, FAN_SOFT_PWM) || (ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER) && DISABLED(HEATER_HARDWARE_PWM))
       constexpr uint8_t pwm_mask = TERN0(SOFT_PWM_DITHER, _BV(SOFT_PWM_SCALE) - 1);
-      #define _PWM_MOD(N,S,T) do{                           \
-        const bool on = S.add(pwm_mask, T.soft_pwm_amount); \
-        WRITE_HEATER_##N(on);                               \
+      #define _PWM_MOD(N,S,V) do{           \
+        const bool on = S.add(pwm_mask, V); \
+        WRITE_HEATER_##N(on);               \
       }while(0)
     #endif
 
@@ -3317,21 +4120,21 @@ void Temperature::isr() {
     if (pwm_count_tmp >= 127) {
       pwm_count_tmp -= 127;
 
-      #if HAS_HOTEND
-        #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
+      #if HAS_HOTEND && DISABLED(HEATER_HARDWARE_PWM)
+        #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N].pwm_duty());
         REPEAT(HOTENDS, _PWM_MOD_E);
       #endif
 
-      #if HAS_HEATED_BED
-        _PWM_MOD(BED, soft_pwm_bed, temp_bed);
+      #if HAS_HEATED_BED && DISABLED(HEATER_HARDWARE_PWM)
+        _PWM_MOD(BED, soft_pwm_bed, temp_bed.pwm_duty());
       #endif
 
-      #if HAS_HEATED_CHAMBER
-        _PWM_MOD(CHAMBER, soft_pwm_chamber, temp_chamber);
+      #if HAS_HEATED_CHAMBER && DISABLED(HEATER_HARDWARE_PWM)
+        _PWM_MOD(CHAMBER, soft_pwm_chamber, temp_chamber.pwm_duty());
       #endif
 
       #if HAS_COOLER
-        _PWM_MOD(COOLER, soft_pwm_cooler, temp_cooler);
+        _PWM_MOD(COOLER, soft_pwm_cooler, temp_cooler.soft_pwm_amount);
       #endif
 
       #if ENABLED(FAN_SOFT_PWM)
@@ -3374,16 +4177,16 @@ void Temperature::isr() {
     }
     else {
       #define _PWM_LOW(N,S) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
-      #if HAS_HOTEND
+      #if HAS_HOTEND && DISABLED(HEATER_HARDWARE_PWM)
         #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
         REPEAT(HOTENDS, _PWM_LOW_E);
       #endif
 
-      #if HAS_HEATED_BED
+      #if HAS_HEATED_BED && DISABLED(HEATER_HARDWARE_PWM)
         _PWM_LOW(BED, soft_pwm_bed);
       #endif
 
-      #if HAS_HEATED_CHAMBER
+      #if HAS_HEATED_CHAMBER && DISABLED(HEATER_HARDWARE_PWM)
         _PWM_LOW(CHAMBER, soft_pwm_chamber);
       #endif
 
@@ -3440,7 +4243,7 @@ void Temperature::isr() {
      * For relay-driven heaters
      */
     #define _SLOW_SET(NR,PWM,V) do{ if (PWM.ready(V)) WRITE_HEATER_##NR(V); }while(0)
-    #define _SLOW_PWM(NR,PWM,SRC) do{ PWM.count = SRC.soft_pwm_amount; _SLOW_SET(NR,PWM,(PWM.count > 0)); }while(0)
+    #define _SLOW_PWM(NR,PWM,V) do{ PWM.count = V; _SLOW_SET(NR,PWM,(PWM.count > 0)); }while(0)
     #define _PWM_OFF(NR,PWM) do{ if (PWM.count < slow_pwm_count) _SLOW_SET(NR,PWM,0); }while(0)
 
     static uint8_t slow_pwm_count = 0;
@@ -3448,20 +4251,20 @@ void Temperature::isr() {
     if (slow_pwm_count == 0) {
 
       #if HAS_HOTEND
-        #define _SLOW_PWM_E(N) _SLOW_PWM(N, soft_pwm_hotend[N], temp_hotend[N]);
+        #define _SLOW_PWM_E(N) _SLOW_PWM(N, soft_pwm_hotend[N], temp_hotend[N].pwm_duty());
         REPEAT(HOTENDS, _SLOW_PWM_E);
       #endif
 
       #if HAS_HEATED_BED
-        _SLOW_PWM(BED, soft_pwm_bed, temp_bed);
+        _SLOW_PWM(BED, soft_pwm_bed, temp_bed.pwm_duty());
       #endif
 
       #if HAS_HEATED_CHAMBER
-        _SLOW_PWM(CHAMBER, soft_pwm_chamber, temp_chamber);
+        _SLOW_PWM(CHAMBER, soft_pwm_chamber, temp_chamber.pwm_duty());
       #endif
 
       #if HAS_COOLER
-        _SLOW_PWM(COOLER, soft_pwm_cooler, temp_cooler);
+        _SLOW_PWM(COOLER, soft_pwm_cooler, temp_cooler.soft_pwm_amount);
       #endif
 
     } // slow_pwm_count == 0
@@ -3573,6 +4376,38 @@ void Temperature::isr() {
   static bool do_buttons;
   if ((do_buttons ^= true)) ui.update_buttons();
 
+#if ENABLED(ADC_SCAN_SAMPLING)
+
+  /**
+   * All sensors are read together once every ACTUAL_ADC_SAMPLES calls of the ISR,
+   * so readings_ready() is called at the same rate as PID_dT expects. Filament width
+   * and power monitor readings are taken on every call, which shortens the time
+   * constant of their filters compared to the one-sensor-per-state sequence.
+   */
+  static uint8_t scan_count = 0;
+  if (++scan_count >= ACTUAL_ADC_SAMPLES) {
+    scan_count = 0;
+    if (adc_scan()) readings_ready();
+  }
+
+  #if ENABLED(FILAMENT_WIDTH_SENSOR)
+    hal.adc_start(FILWIDTH_PIN);
+    filwidth.accumulate(hal.adc_value());
+  #endif
+  #if ENABLED(POWER_MONITOR_CURRENT)
+    hal.adc_start(POWER_MONITOR_CURRENT_PIN);
+    power_monitor.add_current_sample(hal.adc_value());
+  #endif
+  #if ENABLED(POWER_MONITOR_VOLTAGE)
+    hal.adc_start(POWER_MONITOR_VOLTAGE_PIN);
+    power_monitor.add_voltage_sample(hal.adc_value());
+  #endif
+
+#else // !ADC_SCAN_SAMPLING
+
+  static int8_t temp_count = -1;
+  static ADCSensorState adc_sensor_state = StartupDelay;
+
   /**
    * One sensor is sampled on every other call of the ISR.
    * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
@@ -3766,6 +4601,8 @@ void Temperature::isr() {
   // Go to the next state
   adc_sensor_state = next_sensor_state;
 
+#endif // !ADC_SCAN_SAMPLING
+
   //
   // Additional ~1kHz Tasks
   //
@@ -94,7 +94,7 @@ hotend_pid_t;
   #define _PID_Kf(H) 0
 #endif
 
-#if ENABLED(MPCTEMP)
+#if HAS_MPC
   typedef struct {
     float heater_power;                 // M306 P
     float block_heat_capacity;          // M306 C
@@ -199,7 +199,7 @@ enum ADCSensorState : char {
   #define unscalePID_d(d) ( float(d) * PID_dT )
 #endif
 
-#if ENABLED(MPCTEMP)
+#if HAS_MPC
   #define MPC_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
 #endif
 
@@ -228,10 +228,53 @@ public:
   } redundant_info_t;
 #endif
 
+#if ENABLED(HEATER_HARDWARE_PWM)
+  #define HEATER_PWM_MAX uint16_t(_BV32(HEATER_PWM_RESOLUTION) - 1)
+#endif
+
 // A PWM heater with temperature sensor
 typedef struct HeaterInfo : public TempInfo {
   celsius_t target;
   uint8_t soft_pwm_amount;
+  #if ENABLED(HEATER_POWER_BUDGET)
+    uint8_t soft_pwm_budget;  // Most duty the power budget allows. Updated by manage_power_budget.
+    uint8_t budget_request;   // The soft_pwm_amount the last manage_power_budget call granted against
+    millis_t budget_ms;       // Time of the last budget_slip call
+    uint8_t pwm_duty() const { return _MIN(soft_pwm_amount, soft_pwm_budget); }
+    bool budget_limited() const { return soft_pwm_budget < soft_pwm_amount; }
+    // The budget has seen the current duty and granted less
+    bool budget_refused() const { return budget_request == soft_pwm_amount && budget_limited(); }
+    // While the budget holds the heater back, the share of the time since the last
+    // call that it spent without full power. Heating deadlines are pushed back by this
+    // much, so the heater is expected to heat at a rate scaled to the duty it's granted.
+    millis_t budget_slip(const millis_t ms) {
+      const millis_t dt = _MIN(ms - budget_ms, 1000UL);
+      budget_ms = ms;
+      return budget_limited() ? dt * (127 - soft_pwm_budget) / 127 : 0;
+    }
+  #else
+    uint8_t pwm_duty() const { return soft_pwm_amount; }
+  #endif
+  #if ENABLED(HEATER_HARDWARE_PWM)
+    uint16_t pwm_fine;        // Last controller output, scaled to HEATER_PWM_MAX
+    uint8_t pwm_fine_amount;  // The soft_pwm_amount set along with pwm_fine
+
+    // Duty for the hardware PWM. Use the full resolution output unless
+    // the duty has since been changed, limited, or turned off.
+    uint16_t hw_pwm_duty() const {
+      const uint8_t d = pwm_duty();
+      if (d && d == soft_pwm_amount && d == pwm_fine_amount) return pwm_fine;
+      return uint32_t(d) * (HEATER_PWM_MAX) / 127;
+    }
+  #endif
+  // Set the duty from a PID or MPC output (0-255)
+  void set_output(const float out) {
+    soft_pwm_amount = int(out) >> 1;
+    #if ENABLED(HEATER_HARDWARE_PWM)
+      pwm_fine = out * (HEATER_PWM_MAX) / 255;
+      pwm_fine_amount = soft_pwm_amount;
+    #endif
+  }
   bool is_below_target(const celsius_t offs=0) const { return (celsius < (target + offs)); }
 } heater_info_t;
 
@@ -241,7 +284,7 @@ struct PIDHeaterInfo : public HeaterInfo {
   T pid;  // Initialized by settings.load()
 };
 
-#if ENABLED(MPCTEMP)
+#if HAS_MPC
   struct MPCHeaterInfo : public HeaterInfo {
     MPC_t constants;
     float modeled_ambient_temp,
@@ -260,6 +303,8 @@ struct PIDHeaterInfo : public HeaterInfo {
 #if HAS_HEATED_BED
   #if ENABLED(PIDTEMPBED)
     typedef struct PIDHeaterInfo<PID_t> bed_info_t;
+  #elif ENABLED(MPCTEMPBED)
+    typedef struct MPCHeaterInfo bed_info_t;
   #else
     typedef heater_info_t bed_info_t;
   #endif
@@ -267,6 +312,8 @@ struct PIDHeaterInfo : public HeaterInfo {
 #if HAS_HEATED_CHAMBER
   #if ENABLED(PIDTEMPCHAMBER)
     typedef struct PIDHeaterInfo<PID_t> chamber_info_t;
+  #elif ENABLED(MPCTEMPCHAMBER)
+    typedef struct MPCHeaterInfo chamber_info_t;
   #else
     typedef heater_info_t chamber_info_t;
   #endif
@@ -293,6 +340,9 @@ struct HeaterWatch {
 
   inline bool check(const celsius_t curr) { return curr >= target; }
 
+  // Push back a running watch, as while the heater can't get the power it asks for
+  inline void delay(const millis_t ms) { if (next_ms) next_ms += ms; }
+
   inline void restart(const celsius_t curr, const celsius_t tgt) {
     if (tgt) {
       const celsius_t newtarget = curr + INCREASE;
@@ -384,6 +434,10 @@ typedef struct { raw_adc_t raw_min, raw_max; celsius_t mintemp, maxtemp; } temp_
   #define HAS_FAN_LOGIC 1
 #endif
 
+#if HAS_PID_HEATING
+  struct pid_relay_t; // PID autotune relay state
+#endif
+
 class Temperature {
 
   public:
@@ -534,7 +588,9 @@ class Temperature {
       #if ENABLED(WATCH_BED)
         static bed_watch_t watch_bed;
       #endif
-      IF_DISABLED(PIDTEMPBED, static millis_t next_bed_check_ms);
+      #if NONE(PIDTEMPBED, MPCTEMPBED)
+        static millis_t next_bed_check_ms;
+      #endif
       static raw_adc_t mintemp_raw_BED, maxtemp_raw_BED;
     #endif
 
@@ -542,7 +598,9 @@ class Temperature {
       #if ENABLED(WATCH_CHAMBER)
         static chamber_watch_t watch_chamber;
       #endif
-      TERN(PIDTEMPCHAMBER,,static millis_t next_chamber_check_ms);
+      #if NONE(PIDTEMPCHAMBER, MPCTEMPCHAMBER)
+        static millis_t next_chamber_check_ms;
+      #endif
       static raw_adc_t mintemp_raw_CHAMBER, maxtemp_raw_CHAMBER;
     #endif
 
@@ -959,6 +1017,15 @@ class Temperature {
 
       static void PID_autotune(const celsius_t target, const heater_id_t heater_id, const int8_t ncycles, const bool set_result=false);
 
+      #if ENABLED(PID_AUTOTUNE_CONCURRENT)
+        // Background autotune (M303 B), stepped by manage_heater
+        static void PID_autotune_start(const celsius_t target, const heater_id_t heater_id, const int8_t ncycles, const bool set_result=false);
+        static void PID_autotune_cancel(const heater_id_t heater_id=H_NONE);
+        static int16_t PID_autotune_pwm(const heater_id_t heater_id);
+        static void PID_autotune_task(const millis_t &ms);
+        static celsius_t PID_autotune_runaway_target(const heater_id_t heater_id, const celsius_t target);
+      #endif
+
       #if ENABLED(NO_FAN_SLOWING_IN_PID_TUNING)
         static bool adaptive_fan_slowing;
       #elif ENABLED(ADAPTIVE_FAN_SLOWING)
@@ -976,8 +1043,8 @@ class Temperature {
 
     #endif
 
-    #if ENABLED(MPCTEMP)
-      void MPC_autotune();
+    #if HAS_MPC
+      void MPC_autotune(const heater_id_t hid=H_E0);
     #endif
 
     #if ENABLED(PROBING_HEATERS_OFF)
@@ -1033,6 +1100,14 @@ class Temperature {
       return true;
     }
 
+    #if ENABLED(HEATER_POWER_BUDGET)
+      static void manage_power_budget();
+    #endif
+
+    #if ENABLED(HEATER_HARDWARE_PWM)
+      static void update_heater_pwm();
+    #endif
+
     // MAX Thermocouples
     #if HAS_MAX_TC
       #define MAX_TC_COUNT COUNT_ENABLED(TEMP_SENSOR_0_IS_MAX_TC, TEMP_SENSOR_1_IS_MAX_TC, TEMP_SENSOR_REDUNDANT_IS_MAX_TC)
@@ -1055,14 +1130,23 @@ class Temperature {
     #if HAS_HOTEND
       static float get_pid_output_hotend(const uint8_t e);
     #endif
-    #if ENABLED(PIDTEMPBED)
+    #if EITHER(PIDTEMPBED, MPCTEMPBED)
       static float get_pid_output_bed();
     #endif
-    #if ENABLED(PIDTEMPCHAMBER)
+    #if EITHER(PIDTEMPCHAMBER, MPCTEMPCHAMBER)
       static float get_pid_output_chamber();
     #endif
 
     static void _temp_error(const heater_id_t e, FSTR_P const serial_msg, FSTR_P const lcd_msg);
+
+    #if HAS_PID_HEATING
+      // One relay procedure shared by the blocking and background autotune
+      enum PIDRelayResult : uint8_t { PID_RELAY_RUNNING, PID_RELAY_DONE, PID_RELAY_TOO_HOT, PID_RELAY_TIMEOUT, PID_RELAY_OVER_BUDGET };
+      static void PID_relay_start(pid_relay_t &r, const millis_t &ms);
+      static PIDRelayResult PID_relay_update(pid_relay_t &r, const millis_t &ms);
+      static void PID_relay_end(const pid_relay_t &r, const PIDRelayResult result);
+    #endif
+
     static void min_temp_error(const heater_id_t e);
     static void max_temp_error(const heater_id_t e);
 
@@ -1105,6 +1189,10 @@ class Temperature {
           celsius_float_t last_temp = 0.0, variance = 0.0;
         #endif
         void run(const_celsius_float_t current, const_celsius_float_t target, const heater_id_t heater_id, const uint16_t period_seconds, const celsius_t hysteresis_degc);
+        #if ENABLED(HEATER_POWER_BUDGET)
+          // Push back the runaway deadline while the power budget holds the heater back
+          void delay(const millis_t ms) { if (state == TRStable) timer += ms; }
+        #endif
       } tr_state_machine_t;
 
       static tr_state_machine_t tr_state_machine[NR_HEATER_RUNAWAY];
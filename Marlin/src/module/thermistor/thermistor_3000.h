@@ -11,21 +11,21 @@
 
  
 constexpr temp_entry_t temptable_3000[] PROGMEM = {
-  { OV(1023),  -40 },
-  { OV(1019),  -25 },
-  { OV(1007),    0 },
-  { OV( 997),   25 },
-  { OV( 981),   50 },
-  { OV( 960),   75 },
-  { OV( 933),  100 },
-  { OV( 900),  125 },
-  { OV( 859),  150 },
-  { OV( 809),  175 },
-  { OV( 748),  200 },
-  { OV( 676),  225 },
-  { OV( 589),  250 },
+  { OV( 352),  300 },
   { OV( 484),  275 },
-  { OV( 352),  300 }
+  { OV( 589),  250 },
+  { OV( 676),  225 },
+  { OV( 748),  200 },
+  { OV( 809),  175 },
+  { OV( 859),  150 },
+  { OV( 900),  125 },
+  { OV( 933),  100 },
+  { OV( 960),   75 },
+  { OV( 981),   50 },
+  { OV( 997),   25 },
+  { OV(1007),    0 },
+  { OV(1019),  -25 },
+  { OV(1023),  -40 }
 };
 
 #define TT_3000  { OV(3000), temptable_3000, COUNT(temptable_3000), 0 }
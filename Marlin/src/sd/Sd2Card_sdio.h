@@ -32,6 +32,11 @@ bool SDIO_WriteBlock(uint32_t block, const uint8_t *src);
 bool SDIO_IsReady();
 uint32_t SDIO_GetCardSize();
 
+#if HAS_SDIO_ASYNC_READ
+  bool SDIO_ReadBlockAsync(uint32_t block, uint8_t *dst);
+  int8_t SDIO_ReadBlockPoll();
+#endif
+
 class DiskIODriver_SDIO : public DiskIODriver {
   public:
     bool init(const uint8_t sckRateID=0, const pin_t chipSelectPin=0) override { return SDIO_Init(); }
@@ -46,14 +51,40 @@ class DiskIODriver_SDIO : public DiskIODriver {
     bool writeData(const uint8_t *src)                    override { return writeBlock(curBlock++, src); }
     bool writeStop()                                      override { curBlock = -1; return true; }
 
-    bool readBlock(uint32_t block, uint8_t *dst)          override { return SDIO_ReadBlock(block, dst); }
-    bool writeBlock(uint32_t block, const uint8_t *src)   override { return SDIO_WriteBlock(block, src); }
+    bool readBlock(uint32_t block, uint8_t *dst)          override { waitRead(); return SDIO_ReadBlock(block, dst); }
+    bool writeBlock(uint32_t block, const uint8_t *src)   override { waitRead(); return SDIO_WriteBlock(block, src); }
 
     uint32_t cardSize()                                   override { return SDIO_GetCardSize(); }
 
     bool isReady()                                        override { return SDIO_IsReady(); }
 
     void idle()                                           override {}
+
+    #if HAS_SDIO_ASYNC_READ
+      bool asyncRead()                                    override { return true; }
+
+      bool readBlockAsync(const uint32_t block, uint8_t *dst, diskio_callback_t callback=nullptr) override {
+        waitRead();
+        if (!SDIO_ReadBlockAsync(block, dst)) return false;
+        async_callback = callback;
+        async_status = DISKIO_BUSY;
+        return true;
+      }
+
+      DiskIOStatus pollRead()                             override { updateRead(); return finishRead(async_status); }
+    #endif
+
   private:
     uint32_t curBlock;
+
+    #if HAS_SDIO_ASYNC_READ
+      void updateRead() {
+        if (async_status != DISKIO_BUSY) return;
+        const int8_t r = SDIO_ReadBlockPoll();
+        if (r) async_status = r > 0 ? DISKIO_DONE : DISKIO_ERROR;
+      }
+      void waitRead() { while (async_status == DISKIO_BUSY) updateRead(); }
+    #else
+      void waitRead() {}
+    #endif
 };
@@ -40,11 +40,124 @@
 #include "SdBaseFile.h"
 
 #include "../MarlinCore.h"
+
+#if ENABLED(SD_IO_STATS)
+  #include "SdStats.h"
+#endif
 SdBaseFile *SdBaseFile::cwd_ = 0;   // Pointer to Current Working Directory
 
 // callback function for date/time
 void (*SdBaseFile::dateTime_)(uint16_t *date, uint16_t *time) = 0;
 
+#if ENABLED(SD_EXTENT_CACHE)
+
+  // Forget all runs and start over with the first cluster of a file
+  void FatExtentMap::reset(const uint32_t firstCluster) {
+    count = 0;
+    mapped = 0;
+    if (firstCluster) add(0, firstCluster);
+  }
+
+  // Start over from a cluster past the known ones, to follow the chain from there
+  void FatExtentMap::hint(const uint32_t index, const uint32_t cluster) {
+    if (index < mapped) return;
+    if (index > mapped) { count = 0; mapped = index; }
+    add(index, cluster);
+  }
+
+  // Record the cluster at an index in the file, if it extends the map
+  void FatExtentMap::add(const uint32_t index, const uint32_t cluster) {
+    if (index != mapped) return;
+    if (count && cluster == run[count - 1].cluster + (index - run[count - 1].index))
+      mapped++;                       // continues the last run
+    else if (count < SD_EXTENT_CACHE_SIZE) {
+      run[count].index = index;       // starts a new run
+      run[count].cluster = cluster;
+      count++;
+      mapped++;
+    }
+  }
+
+  /**
+   * Find the known cluster closest to (at or before) a cluster index in the file.
+   * On return index is reduced to the last known cluster, if beyond it.
+   */
+  bool FatExtentMap::locate(uint32_t &index, uint32_t &cluster) const {
+    if (!count || index < run[0].index) return false;
+    NOMORE(index, mapped - 1);
+    // binary search for the last run starting at or before index
+    uint8_t lo = 0, hi = count - 1;
+    while (lo < hi) {
+      const uint8_t mid = (lo + hi + 1) >> 1;
+      if (run[mid].index <= index) lo = mid; else hi = mid - 1;
+    }
+    cluster = run[lo].cluster + (index - run[lo].index);
+    return true;
+  }
+
+  /**
+   * Attach a map of the cluster chain, filled in as the file is read, to make
+   * seeks fast. Only for files open read-only, since the map doesn't follow
+   * changes to the chain. The map is detached when the file is closed.
+   */
+  bool SdBaseFile::setExtentMap(FatExtentMap * const map) {
+    if (!isFile() || (flags_ & O_WRITE)) return false;
+    extents_ = map;
+    if (map) map->reset(firstCluster_);
+    return true;
+  }
+
+  // The cluster that seekSet(pos) would select, if the map knows it. Otherwise 0.
+  uint32_t SdBaseFile::mappedCluster(const uint32_t pos) const {
+    if (!extents_ || !pos || pos > fileSize_) return 0;
+    const uint32_t index = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
+    uint32_t n = index, c;
+    return extents_->locate(n, c) && n == index ? c : 0;
+  }
+
+  // Give the map the cluster for seekSet(pos), as found by mappedCluster before a reboot
+  bool SdBaseFile::hintCluster(const uint32_t pos, const uint32_t cluster) {
+    if (!extents_ || !pos || pos > fileSize_ || cluster < 2 || cluster > vol_->clusterCount_ + 1) return false;
+    extents_->hint((pos - 1) >> (vol_->clusterSizeShift_ + 9), cluster);
+    return true;
+  }
+
+#endif // SD_EXTENT_CACHE
+
+// Get the cluster at an index in the file, replacing the cluster before it in *cluster
+bool SdBaseFile::nextCluster(const uint32_t index, uint32_t * const cluster) {
+  #if ENABLED(SD_EXTENT_CACHE)
+    if (extents_) {
+      uint32_t known = index, c;
+      if (extents_->locate(known, c) && known == index) {
+        *cluster = c;
+        TERN_(SD_IO_STATS, ++SdStats::extent_steps);
+        return true;
+      }
+    }
+  #endif
+  TERN_(SD_IO_STATS, ++SdStats::fat_steps);
+  if (!vol_->fatGet(*cluster, cluster)) return false;
+  #if ENABLED(SD_EXTENT_CACHE)
+    if (extents_ && !vol_->isEOC(*cluster)) extents_->add(index, *cluster);
+  #endif
+  return true;
+}
+
+// Advance to the next cluster for writing, adding one at the end of the chain
+bool SdBaseFile::nextWriteCluster() {
+  if (curCluster_ == 0) {
+    if (firstCluster_ == 0) return addCluster();  // allocate first cluster of file
+    curCluster_ = firstCluster_;
+    return true;
+  }
+  uint32_t next;
+  if (!vol_->fatGet(curCluster_, &next)) return false;
+  if (vol_->isEOC(next)) return addCluster();     // add cluster if at end of chain
+  curCluster_ = next;
+  return true;
+}
+
 // add a cluster to a file
 bool SdBaseFile::addCluster() {
   if (ENABLED(SDCARD_READONLY)) return false;
@@ -106,6 +219,7 @@ dir_t* SdBaseFile::cacheDirEntry(uint8_t action) {
 bool SdBaseFile::close() {
   bool rtn = sync();
   type_ = FAT_FILE_TYPE_CLOSED;
+  TERN_(SD_EXTENT_CACHE, extents_ = nullptr);
   return rtn;
 }
 
@@ -140,6 +254,31 @@ bool SdBaseFile::contiguousRange(uint32_t *bgnBlock, uint32_t *endBlock) {
   return false;
 }
 
+/**
+ * Allocate contiguous clusters for an empty file that will be written up
+ * to a known size, so the data needs no FAT updates as it's written and
+ * whole runs of blocks can be written at once. The size isn't changed and
+ * clusters left unused should be freed with truncate() when done.
+ *
+ * \param[in] size The expected size of the file in bytes.
+ *
+ * \return true for success, false for failure.
+ * Reasons for failure include a file that isn't empty or open for write,
+ * or no contiguous free space of the size requested.
+ */
+bool SdBaseFile::preAllocate(const uint32_t size) {
+  if (ENABLED(SDCARD_READONLY)) return false;
+  if (!isFile() || !(flags_ & O_WRITE) || firstCluster_ || !size) return false;
+
+  // allocate clusters for the whole file
+  const uint32_t count = ((size - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
+  if (!vol_->allocContiguous(count, &firstCluster_)) return false;
+
+  // insure sync() will update dir entry
+  flags_ |= F_FILE_DIR_DIRTY;
+  return sync();
+}
+
 /**
  * Create and open a new contiguous file of a specified size.
  *
@@ -1387,7 +1526,7 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
         // start of new cluster
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
-        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+        else if (!nextCluster(curPosition_ >> (vol_->clusterSizeShift_ + 9), &curCluster_)) // get next cluster from FAT
           return -1;
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
@@ -1399,7 +1538,10 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
 
     // no buffering needed if n == 512
     if (n == 512 && block != vol_->cacheBlockNumber()) {
-      if (!vol_->readBlock(block, dst)) return -1;
+      TERN_(SD_IO_STATS, const uint32_t start_us = micros());
+      const bool ok = vol_->readBlock(block, dst);
+      TERN_(SD_IO_STATS, SdStats::read_done(start_us, 1, ok));
+      if (!ok) return -1;
     }
     else {
       // read block to cache and copy data to caller
@@ -1414,6 +1556,159 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
   return nbyte;
 }
 
+/**
+ * Locate the blocks at the current block-aligned position that are contiguous
+ * on the volume, and advance the position past them. The volume cache is
+ * written back so the blocks can be read directly from the device.
+ *
+ * \param[out] block The first block of the run.
+ *
+ * \param[in] count Maximum number of blocks.
+ *
+ * \return The number of blocks in the run, zero at end of file, or -1 on error.
+ * The position advances by the size of the run, up to the end of file.
+ */
+int8_t SdBaseFile::nextBlocks(uint32_t * const block, const uint8_t count) {
+  // error if not open, write only, or not on a block boundary
+  if (!isOpen() || !(flags_ & O_READ) || (curPosition_ & 0x1FF) || type_ == FAT_FILE_TYPE_ROOT_FIXED) return -1;
+
+  if (curPosition_ >= fileSize_ || !count) return 0;
+
+  // blocks left in the file
+  uint8_t n = count;
+  NOMORE(n, (fileSize_ - curPosition_ + 0x1FF) >> 9);
+
+  // first block, following the cluster chain as in read()
+  // (the position only changes on success, so a failed call can be retried)
+  uint32_t index = curPosition_ >> (vol_->clusterSizeShift_ + 9), cluster = curCluster_;
+  const uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+  if (blockOfCluster == 0) {
+    if (curPosition_ == 0)
+      cluster = firstCluster_;
+    else if (!nextCluster(index, &cluster))
+      return -1;
+  }
+  *block = vol_->clusterStartBlock(cluster) + blockOfCluster;
+
+  // extend the run over physically adjacent clusters
+  uint8_t run = _MIN(n, vol_->blocksPerCluster() - blockOfCluster);
+  while (run < n) {
+    uint32_t next = cluster;
+    if (!nextCluster(index + 1, &next)) return -1;
+    if (next != cluster + 1) break;
+    cluster = next;
+    index++;
+    run += _MIN(n - run, vol_->blocksPerCluster());
+  }
+
+  // write back the cache in case it holds a modified block of this run
+  if (!vol_->cacheFlush()) return -1;
+
+  curCluster_ = cluster;
+  curPosition_ += _MIN(uint32_t(run) << 9, fileSize_ - curPosition_);
+  return run;
+}
+
+/**
+ * Read whole blocks from a file starting at the current block-aligned position.
+ * Blocks that are contiguous on the volume are read with a single multi-block
+ * read. Reading stops at the end of the file or of a contiguous run.
+ *
+ * \param[out] dst Pointers to 512 byte buffers that will receive the data.
+ *
+ * \param[in] count Maximum number of blocks to read.
+ *
+ * \return The number of blocks read, zero at end of file, or -1 on error.
+ * The position is unchanged on error.
+ */
+int8_t SdBaseFile::readBlocks(uint8_t * const dst[], const uint8_t count) {
+  const uint32_t pos = curPosition_, cluster = curCluster_;
+  uint32_t block;
+  const int8_t run = nextBlocks(&block, count);
+  if (run <= 0) return run;
+
+  DiskIODriver * const dev = vol_->sdCard();
+  TERN_(SD_IO_STATS, const uint32_t start_us = micros());
+  bool ok = run == 1 ? dev->readBlock(block, dst[0]) : dev->readStart(block);
+  if (ok && run > 1) {
+    for (uint8_t i = 0; ok && i < run; i++) ok = dev->readData(dst[i]);
+    ok = dev->readStop() && ok;
+  }
+  TERN_(SD_IO_STATS, SdStats::read_done(start_us, run, ok));
+  if (ok) return run;
+  // Rewind so the same blocks are read by the next call
+  curPosition_ = pos;
+  curCluster_ = cluster;
+  return -1;
+}
+
+/**
+ * Write whole blocks to a file starting at the current block-aligned position.
+ * Blocks that are contiguous on the volume are written with a single multi-block
+ * write. Writing stops at the end of a contiguous run, which is never past the
+ * end of a cluster unless the chain continues there (e.g., after preAllocate()).
+ *
+ * \param[in] src Pointers to 512 byte buffers holding the data.
+ *
+ * \param[in] count Maximum number of blocks to write.
+ *
+ * \return The number of blocks written, or -1 on error.
+ */
+int8_t SdBaseFile::writeBlocks(const uint8_t * const src[], const uint8_t count) {
+  if (ENABLED(SDCARD_READONLY)) return -1;
+
+  // error if not a normal file, read-only, or not on a block boundary
+  if (!isFile() || !(flags_ & O_WRITE) || (curPosition_ & 0x1FF)) return -1;
+  if ((flags_ & O_APPEND) && curPosition_ != fileSize_) return -1;
+  if (!count) return 0;
+
+  // first block, following or extending the cluster chain as in write()
+  // (a cluster added to the chain stays there, but the position only changes
+  // on success, so write() can continue from the same place after an error)
+  const uint32_t prevCluster = curCluster_;
+  const uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+  if (blockOfCluster == 0 && !nextWriteCluster()) { curCluster_ = prevCluster; return -1; }
+  uint32_t cluster = curCluster_;
+  curCluster_ = prevCluster;
+  const uint32_t block = vol_->clusterStartBlock(cluster) + blockOfCluster;
+
+  // extend the run over adjacent clusters already in the chain
+  uint8_t run = _MIN(count, vol_->blocksPerCluster() - blockOfCluster);
+  while (run < count) {
+    uint32_t next;
+    if (!vol_->fatGet(cluster, &next)) return -1;
+    if (next != cluster + 1) break;
+    cluster = next;
+    run += _MIN(count - run, vol_->blocksPerCluster());
+  }
+
+  // write back the cache, and drop it if it holds a block of the run
+  if (!vol_->cacheFlush()) return -1;
+  if (WITHIN(vol_->cacheBlockNumber(), block, block + run - 1))
+    vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
+
+  DiskIODriver * const dev = vol_->sdCard();
+  if (run == 1) {
+    if (!dev->writeBlock(block, src[0])) return -1;
+  }
+  else {
+    if (!dev->writeStart(block, run)) return -1;
+    for (uint8_t i = 0; i < run; i++)
+      if (!dev->writeData(src[i])) { dev->writeStop(); return -1; }
+    if (!dev->writeStop()) return -1;
+  }
+
+  curCluster_ = cluster;
+  curPosition_ += uint32_t(run) << 9;
+  if (curPosition_ > fileSize_) fileSize_ = curPosition_;
+
+  // insure sync will update the size, and modified date and time
+  flags_ |= F_FILE_DIR_DIRTY;
+  if ((flags_ & O_SYNC) && !sync()) return -1;
+
+  return run;
+}
+
 /**
  * Read the next entry in a directory.
  *
@@ -1866,6 +2161,7 @@ bool SdBaseFile::rmRfStar() {
 SdBaseFile::SdBaseFile(const char *path, uint8_t oflag) {
   type_ = FAT_FILE_TYPE_CLOSED;
   writeError = false;
+  TERN_(SD_EXTENT_CACHE, extents_ = nullptr);
   open(path, oflag);
 }
 
@@ -1894,14 +2190,24 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
-  if (nNew < nCur || curPosition_ == 0)
-    curCluster_ = firstCluster_;      // must follow chain from first cluster
-  else
-    nNew -= nCur;                     // advance from curPosition
+  uint32_t cluster = curCluster_;    // leave the position unchanged on failure
+  if (nNew < nCur || curPosition_ == 0) {
+    cluster = firstCluster_;          // must follow chain from first cluster
+    nCur = 0;
+  }
+
+  #if ENABLED(SD_EXTENT_CACHE)
+    // skip ahead to the closest cluster in the map
+    if (extents_) {
+      uint32_t n = nNew, c;
+      if (extents_->locate(n, c) && n > nCur) { nCur = n; cluster = c; }
+    }
+  #endif
 
-  while (nNew--)
-    if (!vol_->fatGet(curCluster_, &curCluster_)) return false;
+  while (nCur < nNew)                 // advance from curPosition
+    if (!nextCluster(++nCur, &cluster)) return false;
 
+  curCluster_ = cluster;
   curPosition_ = pos;
   return true;
 }
@@ -2081,8 +2387,8 @@ bool SdBaseFile::truncate(uint32_t length) {
   // error if length is greater than current size
   if (length > fileSize_) return false;
 
-  // fileSize and length are zero - nothing to do
-  if (fileSize_ == 0) return true;
+  // fileSize and length are zero - nothing to do, unless clusters were pre-allocated
+  if (fileSize_ == 0 && firstCluster_ == 0) return true;
 
   // remember position for seek after truncation
   newPos = curPosition_ > length ? length : curPosition_;
@@ -2157,26 +2463,7 @@ int16_t SdBaseFile::write(const void *buf, uint16_t nbyte) {
     uint16_t blockOffset = curPosition_ & 0x1FF;
     if (blockOfCluster == 0 && blockOffset == 0) {
       // start of new cluster
-      if (curCluster_ == 0) {
-        if (firstCluster_ == 0) {
-          // allocate first cluster of file
-          if (!addCluster()) goto FAIL;
-        }
-        else {
-          curCluster_ = firstCluster_;
-        }
-      }
-      else {
-        uint32_t next;
-        if (!vol_->fatGet(curCluster_, &next)) goto FAIL;
-        if (vol_->isEOC(next)) {
-          // add cluster if at end of chain
-          if (!addCluster()) goto FAIL;
-        }
-        else {
-          curCluster_ = next;
-        }
-      }
+      if (!nextWriteCluster()) goto FAIL;
     }
     // max space in block
     uint16_t n = 512 - blockOffset;
@@ -46,6 +46,35 @@ struct filepos_t {
   filepos_t() : position(0), cluster(0) {}
 };
 
+#if ENABLED(SD_EXTENT_CACHE)
+
+  /**
+   * \class FatExtentMap
+   * \brief Map of a file's cluster chain, as runs of consecutive clusters
+   *
+   * Runs are recorded in file order as the chain is followed, so the map
+   * covers the start of the file up to the last cluster it knows. A cluster
+   * past those can be given as a hint, such as the one saved by Power-Loss
+   * Recovery. The map then starts over from there.
+   */
+  class FatExtentMap {
+  public:
+    void reset(const uint32_t firstCluster);
+    void add(const uint32_t index, const uint32_t cluster);
+    void hint(const uint32_t index, const uint32_t cluster);
+    bool locate(uint32_t &index, uint32_t &cluster) const;
+
+  private:
+    struct fat_extent_t {
+      uint32_t index;     // index of the run's first cluster in the file
+      uint32_t cluster;   // first cluster of the run on the volume
+    } run[SD_EXTENT_CACHE_SIZE];
+    uint8_t count;        // number of runs in use
+    uint32_t mapped;      // index after the last cluster known
+  };
+
+#endif
+
 // use the gnu style oflag in open()
 uint8_t const O_READ = 0x01,                    // open() oflag for reading
               O_RDONLY = O_READ,                // open() oflag - same as O_IN
@@ -162,7 +191,7 @@ uint16_t const FAT_DEFAULT_TIME = (1 << 11);
  */
 class SdBaseFile {
  public:
-  SdBaseFile() : writeError(false), type_(FAT_FILE_TYPE_CLOSED) {}
+  SdBaseFile() : writeError(false), type_(FAT_FILE_TYPE_CLOSED) { TERN_(SD_EXTENT_CACHE, extents_ = nullptr); }
   SdBaseFile(const char *path, uint8_t oflag);
   ~SdBaseFile() { if (isOpen()) close(); }
 
@@ -298,7 +327,16 @@ class SdBaseFile {
   bool printName();
   int16_t read();
   int16_t read(void *buf, uint16_t nbyte);
+  int8_t nextBlocks(uint32_t * const block, const uint8_t count);
+  int8_t readBlocks(uint8_t * const dst[], const uint8_t count);
   int8_t readDir(dir_t *dir, char *longFilename);
+  int8_t writeBlocks(const uint8_t * const src[], const uint8_t count);
+  bool preAllocate(const uint32_t size);
+  #if ENABLED(SD_EXTENT_CACHE)
+    bool setExtentMap(FatExtentMap * const map);
+    uint32_t mappedCluster(const uint32_t pos) const;
+    bool hintCluster(const uint32_t pos, const uint32_t cluster);
+  #endif
   static bool remove(SdBaseFile *dirFile, const char *path);
   bool remove();
 
@@ -365,6 +403,9 @@ class SdBaseFile {
   uint32_t  fileSize_;      // file size in bytes
   uint32_t  firstCluster_;  // first cluster of file
   SdVolume  *vol_;          // volume where file is located
+  #if ENABLED(SD_EXTENT_CACHE)
+    FatExtentMap *extents_; // cluster chain map, if any
+  #endif
 
   /**
    * EXPERIMENTAL - Don't use!
@@ -374,6 +415,8 @@ class SdBaseFile {
   // private functions
   bool addCluster();
   bool addDirCluster();
+  bool nextCluster(const uint32_t index, uint32_t * const cluster);
+  bool nextWriteCluster();
   dir_t* cacheDirEntry(uint8_t action);
   int8_t lsPrintNext(uint8_t flags, uint8_t indent);
   static bool make83Name(const char *str, uint8_t *name, const char **ptr);
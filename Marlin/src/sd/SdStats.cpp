@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_IO_STATS)
+
+#include "SdStats.h"
+
+SdStats::ReadStats SdStats::reads;
+uint32_t SdStats::cache_hits, SdStats::cache_misses,
+         SdStats::fat_steps, SdStats::extent_steps,
+         SdStats::fetch_bytes, SdStats::fetch_us;
+millis_t SdStats::start_ms;
+AutoReporter<SdStats::AutoReportSdStats> SdStats::auto_reporter;
+
+void SdStats::ReadStats::add(const uint16_t nblocks, const uint32_t us, const bool ok) {
+  ++ops;
+  blocks += nblocks;
+  if (!ok) ++errors;
+  total_us += us;
+  NOLESS(max_us, us);
+  uint8_t b = 0;
+  for (uint32_t t = us >> 7; t && b < SD_STATS_BUCKETS - 1; t >>= 1) ++b;
+  ++histogram[b];
+}
+
+void SdStats::read_done(const uint32_t start_us, const uint16_t nblocks, const bool ok) {
+  reads.add(nblocks, micros() - start_us, ok);
+}
+
+void SdStats::reset() {
+  reads = {};
+  cache_hits = cache_misses = fat_steps = extent_steps = fetch_bytes = fetch_us = 0;
+  start_ms = millis();
+}
+
+/**
+ * Report the statistics since the last reset:
+ *   SD reads:<ops> blocks:<n> errors:<n> avg_us:<µs per op> max_us:<µs>
+ *   SD latency_us <128:<ops> <256:<ops> ... >=32768:<ops>
+ *   SD cache hit:<n> miss:<n> fat_steps:<n> extent_steps:<n>
+ *   SD fetch bytes:<n> rate:<bytes/s over the elapsed time> fetch_rate:<bytes/s while fetching> io_ms:<ms> fetch_ms:<ms>
+ * io_ms is the total time spent reading the media, and fetch_ms the time spent filling the
+ * command queue, including any reads it had to wait for. A low fetch_rate with little I/O
+ * points at the parser. Slow reads with many fat_steps point at the FAT layer.
+ */
+void SdStats::report() {
+  SERIAL_ECHOLNPGM("SD reads:", reads.ops, " blocks:", reads.blocks, " errors:", reads.errors,
+    " avg_us:", reads.ops ? reads.total_us / reads.ops : 0UL, " max_us:", reads.max_us
+  );
+  SERIAL_ECHOPGM("SD latency_us");
+  LOOP_L_N(i, SD_STATS_BUCKETS) {
+    if (i < SD_STATS_BUCKETS - 1) SERIAL_ECHOPGM(" <", 128UL << i); else SERIAL_ECHOPGM(" >=", 128UL << (i - 1));
+    SERIAL_ECHOPGM(":", reads.histogram[i]);
+  }
+  SERIAL_EOL();
+  SERIAL_ECHOLNPGM("SD cache hit:", cache_hits, " miss:", cache_misses, " fat_steps:", fat_steps, " extent_steps:", extent_steps);
+  const millis_t elapsed = millis() - start_ms;
+  SERIAL_ECHOLNPGM("SD fetch bytes:", fetch_bytes,
+    " rate:", elapsed ? uint32_t(uint64_t(fetch_bytes) * 1000 / elapsed) : 0UL,
+    " fetch_rate:", fetch_us ? uint32_t(uint64_t(fetch_bytes) * 1000000 / fetch_us) : 0UL,
+    " io_ms:", reads.total_us / 1000, " fetch_ms:", fetch_us / 1000
+  );
+}
+
+#endif // SD_IO_STATS
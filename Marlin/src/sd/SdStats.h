@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * sd/SdStats.h
+ *
+ * Counters and a latency histogram for the SD card / USB flash drive read path,
+ * to tell whether a starved print was held up by the media, the FAT layer or the parser.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_IO_STATS)
+
+#include "../libs/autoreport.h"
+
+#define SD_STATS_BUCKETS 10   // Read latency: <128µs, <256µs, ... <32ms, 32ms and more
+
+class SdStats {
+public:
+  // Timed block reads. A multi-block read counts as one operation.
+  struct ReadStats {
+    uint32_t ops, blocks, errors, total_us, max_us, histogram[SD_STATS_BUCKETS];
+    void add(const uint16_t nblocks, const uint32_t us, const bool ok);
+  };
+
+  static ReadStats reads;           // All reads from the media driver
+  static uint32_t cache_hits,       // SdVolume block cache lookups
+                  cache_misses,
+                  fat_steps,        // Cluster chain steps that looked up the FAT
+                  extent_steps,     // Cluster chain steps found in the SD_EXTENT_CACHE
+                  fetch_bytes,      // Bytes delivered to the command queue from the printed file
+                  fetch_us;         // Time spent filling the command queue from the file, I/O included
+  static millis_t start_ms;         // Time of the last reset
+
+  static void reset();
+  static void report();
+
+  // Time a read that started at 'start_us' (from micros())
+  static void read_done(const uint32_t start_us, const uint16_t nblocks, const bool ok);
+
+  struct AutoReportSdStats { static void report() { SdStats::report(); } };
+  static AutoReporter<AutoReportSdStats> auto_reporter;
+};
+
+#endif // SD_IO_STATS
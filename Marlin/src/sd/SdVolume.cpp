@@ -37,6 +37,10 @@
 
 #include "../MarlinCore.h"
 
+#if ENABLED(SD_IO_STATS)
+  #include "SdStats.h"
+#endif
+
 #if !USE_MULTIPLE_CARDS
   // raw block cache
   uint32_t SdVolume::cacheBlockNumber_;  // current block number
@@ -141,9 +145,20 @@ bool SdVolume::cacheFlush() {
 bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
   if (cacheBlockNumber_ != blockNumber) {
     if (!cacheFlush()) return false;
-    if (!sdCard_->readBlock(blockNumber, cacheBuffer_.data)) return false;
+    TERN_(SD_IO_STATS, ++SdStats::cache_misses);
+    TERN_(SD_IO_STATS, const uint32_t start_us = micros());
+    const bool ok = sdCard_->readBlock(blockNumber, cacheBuffer_.data);
+    TERN_(SD_IO_STATS, SdStats::read_done(start_us, 1, ok));
+    if (!ok) {
+      cacheBlockNumber_ = 0xFFFFFFFF;   // The buffer may hold part of the failed read
+      return false;
+    }
     cacheBlockNumber_ = blockNumber;
   }
+  #if ENABLED(SD_IO_STATS)
+    else
+      ++SdStats::cache_hits;
+  #endif
   if (dirty) cacheDirty_ = true;
   return true;
 }
@@ -187,8 +202,13 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t *value) {
   else
     return false;
 
-  if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
-    return false;
+  if (lba != cacheBlockNumber_) {
+    if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
+  }
+  #if ENABLED(SD_IO_STATS)
+    else
+      ++SdStats::cache_hits;
+  #endif
 
   *value = (fatType_ == 16) ? cacheBuffer_.fat16[cluster & 0xFF] : (cacheBuffer_.fat32[cluster & 0x7F] & FAT32MASK);
   return true;
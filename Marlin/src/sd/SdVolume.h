@@ -40,6 +40,8 @@
 
 #if NEED_SD2CARD_SDIO
   #include "Sd2Card_sdio.h"
+#elif NEED_SD2CARD_FILE
+  #include HAL_PATH(../HAL, Sd2Card_file.h)
 #elif NEED_SD2CARD_SPI
   #include "Sd2Card.h"
 #endif
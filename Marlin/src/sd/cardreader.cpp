@@ -55,6 +55,14 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(SD_COMPRESSED_PRINTING)
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+#endif
+
+#if ENABLED(SD_PREFETCH_SPI_FLASH)
+  #include "../libs/W25Qxx.h"
+#endif
+
 #define DEBUG_OUT EITHER(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -96,6 +104,11 @@ uint8_t CardReader::workDirDepth;
     uint8_t CardReader::sort_order[SDSORT_LIMIT];
   #endif
 
+  #if ENABLED(SDSORT_INDEX)
+    SdFile CardReader::sort_index;
+    bool CardReader::sort_index_deferred;
+  #endif
+
   #if ENABLED(SDSORT_USES_RAM)
 
     #if ENABLED(SDSORT_CACHE_NAMES)
@@ -127,7 +140,7 @@ uint8_t CardReader::workDirDepth;
   DiskIODriver_USBFlash CardReader::media_driver_usbFlash;
 #endif
 
-#if NEED_SD2CARD_SDIO || NEED_SD2CARD_SPI
+#if NEED_SD2CARD_SDIO || NEED_SD2CARD_SPI || NEED_SD2CARD_FILE
   CardReader::sdcard_driver_t CardReader::media_driver_sdcard;
 #endif
 
@@ -143,6 +156,49 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
+  __attribute__((aligned(sizeof(size_t)))) uint8_t CardReader::ra_buffer[SD_READ_AHEAD_BLOCKS][512];
+  uint8_t CardReader::ra_head, CardReader::ra_count;
+  bool CardReader::ra_pending, CardReader::ra_retry;
+  uint32_t CardReader::ra_block;
+  uint16_t CardReader::ra_index;
+  uint32_t CardReader::ra_pos;
+
+  #if ENABLED(SD_PREFETCH_CACHE)
+    #if ENABLED(SD_PREFETCH_SPI_FLASH)
+      #define PF_BLOCKS ((SD_PREFETCH_FLASH_SIZE) / 512)
+      #define PF_ADDR(B) ((SD_PREFETCH_FLASH_ADDR) + ((B) % (PF_BLOCKS)) * 512UL)
+      __attribute__((aligned(sizeof(size_t)))) uint8_t CardReader::pf_stage[PF_BURST][512];
+      uint8_t CardReader::pf_staged, CardReader::pf_pages;
+      bool CardReader::pf_flash_ready; // = false
+    #else
+      #define PF_BLOCKS ((SD_PREFETCH_RAM_SIZE) / 512)
+      __attribute__((aligned(sizeof(size_t)))) uint8_t CardReader::pf_ring[PF_BLOCKS][512];
+    #endif
+    uint32_t CardReader::pf_first, CardReader::pf_end;
+  #endif
+#endif
+
+#if ENABLED(SD_EXTENT_CACHE)
+  static FatExtentMap print_extents;  // Cluster chain of the file being printed
+#endif
+
+#if ENABLED(SD_WRITE_BEHIND)
+  // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
+  __attribute__((aligned(sizeof(size_t)))) uint8_t CardReader::wb_buffer[SD_WRITE_BEHIND_BLOCKS][512];
+  uint16_t CardReader::wb_used;
+  bool CardReader::wb_preallocated,
+       CardReader::wb_reclaimed;
+#endif
+
+#if ENABLED(SD_COMPRESSED_PRINTING)
+  CardReader::hs_mark_t CardReader::hs_block, CardReader::hs_index[HS_INDEX_SIZE];
+  uint16_t CardReader::hs_block_remain;
+  uint8_t CardReader::hs_out[32], CardReader::hs_out_count, CardReader::hs_out_index;
+  static heatshrink_decoder sd_hsd;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -221,6 +277,11 @@ bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD,
     || fileIsBinary()                                   // BIN files are accepted
     || (!onlyBin && p.name[8] == 'G'
                  && p.name[9] != '~')                   // Non-backup *.G* files are accepted
+    #if ENABLED(SD_COMPRESSED_PRINTING)
+      || (!onlyBin && p.name[8] == 'H'
+                   && p.name[9] == 'S'
+                   && p.name[10] == ' ')                // Compressed *.HS files are accepted
+    #endif
   );
 }
 
@@ -288,53 +349,80 @@ void CardReader::printListing(
   dir_t p;
   while (parent.readDir(&p, longFilename) > 0) {
     if (DIR_IS_SUBDIR(&p)) {
-
-      size_t lenPrepend = prepend ? strlen(prepend) + 1 : 0;
-      // Allocate enough stack space for the full path including / separator
-      char path[lenPrepend + FILENAME_LENGTH];
-      if (prepend) { strcpy(path, prepend); path[lenPrepend - 1] = '/'; }
-      char* dosFilename = path + lenPrepend;
+      char dosFilename[FILENAME_LENGTH];
       createFilename(dosFilename, p);
+      if (!printListingFolder(parent, dosFilename, prepend
+        OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin)
+        OPTARG(LONG_FILENAME_HOST_SUPPORT, includeLongNames, prependLong)
+      )) return;
+    }
+    else if (is_visible_entity(p OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin)))
+      printListingFile(createFilename(filename, p), p.fileSize, prepend OPTARG(LONG_FILENAME_HOST_SUPPORT, includeLongNames, prependLong));
+  }
+}
 
-      // Get a new directory object using the full path
-      // and dive recursively into it.
-      SdFile child; // child.close() in destructor
-      if (child.open(&parent, dosFilename, O_READ)) {
-        #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
-          if (includeLongNames) {
-            size_t lenPrependLong = prependLong ? strlen(prependLong) + 1 : 0;
-            // Allocate enough stack space for the full long path including / separator
-            char pathLong[lenPrependLong + strlen(longFilename) + 1];
-            if (prependLong) { strcpy(pathLong, prependLong); pathLong[lenPrependLong - 1] = '/'; }
-            strcpy(pathLong + lenPrependLong, longFilename);
-            printListing(child, path OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin), true, pathLong);
-          }
-          else
-            printListing(child, path OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin));
-        #else
-          printListing(child, path OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin));
-        #endif
-      }
-      else {
-        SERIAL_ECHO_MSG(STR_SD_CANT_OPEN_SUBDIR, dosFilename);
-        return;
-      }
+/**
+ * List the files of a subfolder of 'parent' with printListing().
+ * The long name of the folder is taken from longFilename.
+ * Return 'false' if the folder can't be opened.
+ */
+bool CardReader::printListingFolder(
+  SdFile &parent, const char * const dosname, const char * const prepend
+  OPTARG(CUSTOM_FIRMWARE_UPLOAD, const bool onlyBin)
+  OPTARG(LONG_FILENAME_HOST_SUPPORT, const bool includeLongNames)
+  OPTARG(LONG_FILENAME_HOST_SUPPORT, const char * const prependLong)
+) {
+  size_t lenPrepend = prepend ? strlen(prepend) + 1 : 0;
+  // Allocate enough stack space for the full path including / separator
+  char path[lenPrepend + FILENAME_LENGTH];
+  if (prepend) { strcpy(path, prepend); path[lenPrepend - 1] = '/'; }
+  char* dosFilename = path + lenPrepend;
+  strcpy(dosFilename, dosname);
+
+  // Get a new directory object using the full path
+  // and dive recursively into it.
+  SdFile child; // child.close() in destructor
+  if (!child.open(&parent, dosFilename, O_READ)) {
+    SERIAL_ECHO_MSG(STR_SD_CANT_OPEN_SUBDIR, dosFilename);
+    return false;
+  }
+  #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
+    if (includeLongNames) {
+      size_t lenPrependLong = prependLong ? strlen(prependLong) + 1 : 0;
+      // Allocate enough stack space for the full long path including / separator
+      char pathLong[lenPrependLong + strlen(longFilename) + 1];
+      if (prependLong) { strcpy(pathLong, prependLong); pathLong[lenPrependLong - 1] = '/'; }
+      strcpy(pathLong + lenPrependLong, longFilename);
+      printListing(child, path OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin), true, pathLong);
     }
-    else if (is_visible_entity(p OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin))) {
-      if (prepend) { SERIAL_ECHO(prepend); SERIAL_CHAR('/'); }
-      SERIAL_ECHO(createFilename(filename, p));
+    else
+      printListing(child, path OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin));
+  #else
+    printListing(child, path OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin));
+  #endif
+  return true;
+}
+
+//
+// Print one file of a listing. The long name is taken from longFilename.
+//
+void CardReader::printListingFile(
+  const char * const dosname, const uint32_t size, const char * const prepend
+  OPTARG(LONG_FILENAME_HOST_SUPPORT, const bool includeLongNames)
+  OPTARG(LONG_FILENAME_HOST_SUPPORT, const char * const prependLong)
+) {
+  if (prepend) { SERIAL_ECHO(prepend); SERIAL_CHAR('/'); }
+  SERIAL_ECHO(dosname);
+  SERIAL_CHAR(' ');
+  SERIAL_ECHO(size);
+  #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
+    if (includeLongNames) {
       SERIAL_CHAR(' ');
-      SERIAL_ECHO(p.fileSize);
-      #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
-        if (includeLongNames) {
-          SERIAL_CHAR(' ');
-          if (prependLong) { SERIAL_ECHO(prependLong); SERIAL_CHAR('/'); }
-          SERIAL_ECHO(longFilename[0] ? longFilename : filename);
-        }
-      #endif
-      SERIAL_EOL();
+      if (prependLong) { SERIAL_ECHO(prependLong); SERIAL_CHAR('/'); }
+      SERIAL_ECHO(longFilename[0] ? longFilename : dosname);
     }
-  }
+  #endif
+  SERIAL_EOL();
 }
 
 //
@@ -348,6 +436,10 @@ void CardReader::ls(
   TERN_(LONG_FILENAME_HOST_SUPPORT, const bool includeLongNames/*=false*/)
 ) {
   if (flag.mounted) {
+    #if ENABLED(SDSORT_INDEX)
+      // List the root folder from its sort index, if it's current
+      if (flag.workDirIsRoot && sort_index_ls(root OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin) OPTARG(LONG_FILENAME_HOST_SUPPORT, includeLongNames))) return;
+    #endif
     root.rewind();
     printListing(root, nullptr OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin) OPTARG(LONG_FILENAME_HOST_SUPPORT, includeLongNames));
   }
@@ -438,6 +530,7 @@ void CardReader::printSelectedFilename() {
 
 void CardReader::mount() {
   flag.mounted = false;
+  TERN_(POWER_LOSS_JOURNAL, recovery.close()); // The journal may be open on the previous volume
   if (root.isOpen()) root.close();
 
   if (!driver->init(SD_SPI_SPEED, SDSS)
@@ -454,8 +547,10 @@ void CardReader::mount() {
     SERIAL_ECHO_MSG(STR_SD_CARD_OK);
   }
 
-  if (flag.mounted)
+  if (flag.mounted) {
+    TERN_(SD_WRITE_BEHIND, wb_reclaimed = false);
     cdroot();
+  }
   else {
     #if EITHER(HAS_SD_DETECT, USB_FLASH_DRIVE_SUPPORT)
       if (marlin_state != MF_INITIALIZING) LCD_ALERTMESSAGE(MSG_MEDIA_INIT_FAIL);
@@ -473,6 +568,11 @@ void CardReader::mount() {
 #endif
 
 void CardReader::manage_media() {
+  #if ENABLED(SDSORT_INDEX)
+    // Write the sort index that was put off by a print
+    if (sort_index_deferred && isMounted() && !(IS_SD_PRINTING() || isFileOpen())) presort();
+  #endif
+
   static uint8_t prev_stat = 2;     // At boot we don't know if media is present or not
   uint8_t stat = uint8_t(IS_SD_INSERTED());
   if (stat == prev_stat) return;    // Already checked and still no change?
@@ -491,7 +591,8 @@ void CardReader::manage_media() {
   prev_stat = stat;                 // Change now to prevent re-entry in safe_delay
 
   if (stat) {                       // Media Inserted
-    safe_delay(500);                // Some boards need a delay to get settled
+    // Some boards need a delay to get settled. Media present at boot has had time.
+    if (TERN1(FAST_BOOT, old_stat != 2)) safe_delay(500);
 
     // Try to mount the media (only later with SD_IGNORE_AT_STARTUP)
     if (TERN1(SD_IGNORE_AT_STARTUP, old_stat != 2)) mount();
@@ -534,6 +635,8 @@ void CardReader::release() {
   else
     endFilePrintNow();
 
+  TERN_(POWER_LOSS_JOURNAL, recovery.close());
+
   flag.mounted = false;
   flag.workDirIsRoot = true;
   #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
@@ -575,6 +678,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(HAS_DWIN_E3V2_BASIC, HMI_flag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
   if (isFileOpen()) file.close();
+  TERN_(SD_READ_AHEAD, ra_reset());
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -681,6 +785,15 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_EXTENT_CACHE, file.setExtentMap(&print_extents));
+    TERN_(SD_READ_AHEAD, ra_reset());
+    #if ENABLED(SD_PREFETCH_SPI_FLASH)
+      if (!pf_flash_ready) { W25QXX.init(SPI_FULL_SPEED); pf_flash_ready = true; }
+    #endif
+
+    #if ENABLED(SD_COMPRESSED_PRINTING)
+      if (!hs_open()) { file.close(); openFailed(fname); return; }
+    #endif
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -695,6 +808,497 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
     openFailed(fname);
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  void CardReader::ra_reset() {
+    ra_complete(true);
+    ra_retry = false;
+    ra_head = ra_count = 0;
+    ra_index = 0;
+    ra_pos = 0;
+    TERN_(SD_PREFETCH_CACHE, pf_reset(0));
+  }
+
+  // Add the block from a finished asynchronous read to the buffers
+  #if ENABLED(SD_IO_STATS)
+    static uint32_t ra_start_us;  // Start of the asynchronous read
+  #endif
+
+  bool CardReader::ra_complete(const bool wait) {
+    if (!ra_pending) return true;
+    DiskIOStatus status;
+    while ((status = driver->pollRead()) == DISKIO_BUSY) if (!wait) return true;
+    TERN_(SD_IO_STATS, SdStats::read_done(ra_start_us, 1, status == DISKIO_DONE));
+    ra_pending = false;
+    // The file is already past the failed block, so keep it for the next fill
+    ra_retry = status != DISKIO_DONE;
+    if (ra_retry) return false;
+    ++ra_count;
+    return true;
+  }
+
+  /**
+   * Fill the empty read-ahead buffers with the following blocks of the file.
+   * Called from idle() while printing so the SD access is usually done before
+   * the data is needed.
+   *
+   * With a driver that reads asynchronously one block is read in the background
+   * and idle() only checks for its completion. Otherwise contiguous blocks are
+   * fetched with one multi-block read.
+   */
+  bool CardReader::ra_fill(const bool wait/*=false*/) {
+    #if ENABLED(SD_PREFETCH_CACHE)
+
+      // Take the buffered blocks from the prefetch cache. When waiting for
+      // data and the card fails to deliver, retry a few times before giving up.
+      const uint32_t blocks = (file.fileSize() + 0x1FF) >> 9;
+      for (uint8_t tries = 0;;) {
+        const bool ok = pf_fill(ra_next_block());
+        while (ra_count < SD_READ_AHEAD_BLOCKS) {
+          const uint32_t block = ra_next_block();
+          if (block >= blocks || !pf_take(block, ra_buffer[(ra_head + ra_count) % (SD_READ_AHEAD_BLOCKS)], wait)) break;
+          ++ra_count;
+        }
+        if (!wait || ra_count || ra_next_block() >= blocks) return true;
+        if (!ok) {
+          if (++tries >= 5) return false;
+          safe_delay(20);
+        }
+      }
+
+    #else
+
+      if (driver->asyncRead()) {
+        if (!ra_complete(wait)) return false;
+        if (ra_pending || ra_count >= SD_READ_AHEAD_BLOCKS) return true;
+        if (!ra_retry) {
+          const int8_t n = file.nextBlocks(&ra_block, 1);
+          if (n <= 0) return n == 0;
+        }
+        TERN_(SD_IO_STATS, ra_start_us = micros());
+        ra_retry = !driver->readBlockAsync(ra_block, ra_buffer[(ra_head + ra_count) % (SD_READ_AHEAD_BLOCKS)]);
+        if (ra_retry) return false;
+        ra_pending = true;
+        return true;
+      }
+
+      const uint8_t empty = SD_READ_AHEAD_BLOCKS - ra_count;
+      if (!empty) return true;
+      uint8_t *dst[SD_READ_AHEAD_BLOCKS];
+      for (uint8_t i = 0; i < empty; ++i)
+        dst[i] = ra_buffer[(ra_head + ra_count + i) % (SD_READ_AHEAD_BLOCKS)];
+      const int8_t n = file.readBlocks(dst, empty);
+      if (n < 0) return false;
+      ra_count += n;
+      return true;
+
+    #endif
+  }
+
+  // Wait for data in the head buffer. Return false at end of file or on error.
+  bool CardReader::ra_ready() {
+    while (!ra_count)
+      if (!ra_fill(true) || (!ra_count && !ra_pending)) return false;
+    return true;
+  }
+
+  /**
+   * Set the read position, keeping the buffered data if the new
+   * position is within it. Otherwise the file is positioned at the
+   * start of the block and that block is fetched by the next read.
+   */
+  void CardReader::ra_seek(uint32_t pos) {
+    NOMORE(pos, file.fileSize());
+    ra_complete(true);
+    const uint32_t head_pos = ra_pos - ra_index;  // File position of the head buffer
+    if (pos >= head_pos && pos < head_pos + (uint32_t(ra_count) << 9)) {
+      const uint32_t skip = (pos - head_pos) >> 9;
+      ra_head = (ra_head + skip) % (SD_READ_AHEAD_BLOCKS);
+      ra_count -= skip;
+    }
+    else {
+      #if ENABLED(SD_PREFETCH_CACHE)
+        // Keep the cache if it holds the new block or is about to read it
+        const uint32_t block = pos >> 9;
+        if (block < pf_first || block > pf_end + TERN0(SD_PREFETCH_SPI_FLASH, pf_staged)) pf_reset(block);
+      #else
+        file.seekSet(pos & ~0x1FFUL);
+        ra_retry = false;
+      #endif
+      ra_head = ra_count = 0;
+    }
+    ra_index = pos & 0x1FF;
+    ra_pos = pos;
+  }
+
+  int16_t CardReader::ra_read(void *buf, uint16_t nbyte) {
+    uint8_t *dst = (uint8_t*)buf;
+    NOMORE(nbyte, file.fileSize() - ra_pos);
+    uint16_t done = 0;
+    while (done < nbyte) {
+      if (!ra_ready()) return done ? done : -1;
+      const uint16_t n = _MIN(uint16_t(nbyte - done), uint16_t(512 - ra_index));
+      memcpy(dst + done, &ra_buffer[ra_head][ra_index], n);
+      done += n;
+      ra_pos += n;
+      ra_index += n;
+      if (ra_index == 512) { ra_index = 0; ra_head = (ra_head + 1) % (SD_READ_AHEAD_BLOCKS); --ra_count; }
+    }
+    return done;
+  }
+
+  #if ENABLED(SD_PREFETCH_CACHE)
+
+    /**
+     * Read the next burst of the file from the card into the prefetch cache,
+     * unless it would overwrite blocks the read-ahead buffers haven't taken yet.
+     * Bursts end on a 4K boundary so each one fills a single flash sector.
+     * The next call retries a failed read, so brief card hiccups are only
+     * noticed once the cache has drained.
+     *
+     * With SPI flash the blocks are staged in SRAM while the sector is erased,
+     * then programmed a page at a time, so idle() never waits for the flash.
+     */
+    bool CardReader::pf_fill(const uint32_t next) {
+      #if ENABLED(SD_PREFETCH_SPI_FLASH)
+        if (W25QXX.SPI_FLASH_Busy()) return true;
+        if (pf_staged) {
+          if (pf_pages < pf_staged * 2) {
+            const uint16_t ofs = uint16_t(pf_pages) * (SPI_FLASH_PageSize);
+            W25QXX.SPI_FLASH_PageWrite(&pf_stage[0][0] + ofs, PF_ADDR(pf_end) + ofs, SPI_FLASH_PageSize, false);
+            ++pf_pages;
+            return true;
+          }
+          pf_end += pf_staged;
+          pf_staged = pf_pages = 0;
+        }
+      #endif
+
+      const uint32_t blocks = (file.fileSize() + 0x1FF) >> 9;
+      if (pf_end >= blocks) return true;
+
+      const uint32_t burst_end = (pf_end | (PF_BURST - 1)) + 1;
+      if (burst_end > next + PF_BLOCKS) return true;              // The cache is full
+
+      const uint8_t n = _MIN(burst_end, blocks) - pf_end;
+      uint8_t *dst[PF_BURST];
+      for (uint8_t i = 0; i < n; ++i)
+        dst[i] = TERN(SD_PREFETCH_SPI_FLASH, pf_stage[i], pf_ring[(pf_end + i) % (PF_BLOCKS)]);
+
+      // After a seek or a failed read the file has to be positioned first
+      if (file.curPosition() != pf_end << 9 && !file.seekSet(pf_end << 9)) return false;
+      uint8_t got = 0;
+      while (got < n) {
+        const int8_t r = file.readBlocks(dst + got, n - got);
+        if (r <= 0) break;
+        got += r;
+      }
+
+      #if ENABLED(SD_PREFETCH_SPI_FLASH)
+        if (got < n) return false;  // Staged blocks are read again by the next call
+        // Erase the sector, unless it already holds the blocks before this burst
+        if (!(pf_end & (PF_BURST - 1)) || pf_end == pf_first) {
+          if (burst_end > PF_BLOCKS) NOLESS(pf_first, burst_end - PF_BLOCKS); // Blocks in the erased sector
+          W25QXX.SPI_FLASH_SectorErase(PF_ADDR(pf_end) & ~(SPI_FLASH_SectorSize - 1UL), false);
+        }
+        pf_staged = n;
+      #else
+        // Keep the blocks that were read, which replaced the oldest in the ring
+        pf_end += got;
+        if (pf_end > PF_BLOCKS) NOLESS(pf_first, pf_end - PF_BLOCKS);
+      #endif
+      return got == n;
+    }
+
+    // Copy a block from the cache. Return false if it isn't there (yet).
+    bool CardReader::pf_take(const uint32_t block, uint8_t * const dst, const bool wait) {
+      if (block < pf_first) return false;
+      #if ENABLED(SD_PREFETCH_SPI_FLASH)
+        if (block >= pf_end) {
+          if (block >= pf_end + pf_staged) return false;
+          memcpy(dst, pf_stage[block - pf_end], 512);
+          return true;
+        }
+        while (W25QXX.SPI_FLASH_Busy()) if (!wait) return false;
+        W25QXX.SPI_FLASH_BufferRead(dst, PF_ADDR(block), 512);
+      #else
+        if (block >= pf_end) return false;
+        memcpy(dst, pf_ring[block % (PF_BLOCKS)], 512);
+      #endif
+      return true;
+    }
+
+  #endif // SD_PREFETCH_CACHE
+
+#endif // SD_READ_AHEAD
+
+#if ENABLED(SD_IO_STATS)
+
+  /**
+   * Time raw reads from the data area of the mounted volume, bypassing the FAT layer:
+   * 'count' blocks from the start of the area with one multi-block read, then 'count'
+   * single blocks at pseudo-random positions. The reads are added to the statistics.
+   */
+  void CardReader::read_benchmark(const uint16_t count) {
+    if (!isMounted()) { SERIAL_ECHO_MSG(STR_NO_MEDIA); return; }
+    if (flag.sdprinting || flag.saving) { SERIAL_ECHO_MSG(STR_BUSY_PROCESSING); return; }
+
+    const uint32_t first = volume.dataStartBlock(),
+                   blocks = volume.clusterCount() * volume.blocksPerCluster();
+    const uint16_t n = _MIN(uint32_t(count), blocks);
+    if (!n) return;
+
+    __attribute__((aligned(sizeof(size_t)))) uint8_t buf[512];
+    auto report = [](FSTR_P const kind, const uint16_t n, const uint32_t us) {
+      SERIAL_ECHOLNPGM("SD benchmark ", kind, " blocks:", n, " ms:", us / 1000,
+        " KB/s:", us ? uint32_t(uint64_t(n) * 500000UL / us) : 0UL); // n * 512 * 1000000 / 1024 / us
+    };
+
+    // Sequential, multi-block reads of 64 blocks. Keep the heaters and watchdog going
+    // between them, with no multi-block read open while idle() may use the card.
+    uint32_t seq_us = 0;
+    bool ok = true;
+    for (uint16_t i = 0; ok && i < n;) {
+      const uint16_t m = _MIN(n - i, 64);
+      const uint32_t start_us = micros();
+      ok = driver->readStart(first + i);
+      for (uint16_t j = 0; ok && j < m; ++j) ok = driver->readData(buf);
+      if (ok) ok = driver->readStop();
+      seq_us += micros() - start_us;
+      i += m;
+      idle();
+    }
+    SdStats::reads.add(n, seq_us, ok);
+    if (!ok) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); return; }
+    report(F("sequential"), n, seq_us);
+
+    // Random, single blocks spread over the volume
+    uint32_t rnd = 0x2545F491, total_us = 0, max_us = 0;
+    for (uint16_t i = 0; i < n; ++i) {
+      rnd ^= rnd << 13; rnd ^= rnd >> 17; rnd ^= rnd << 5;  // xorshift32
+      const uint32_t start_us = micros();
+      ok = driver->readBlock(first + rnd % blocks, buf);
+      const uint32_t us = micros() - start_us;
+      SdStats::reads.add(1, us, ok);
+      if (!ok) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); return; }
+      total_us += us;
+      NOLESS(max_us, us);
+      if (!(i & 0x3F)) idle();
+    }
+    report(F("random"), n, total_us);
+    SERIAL_ECHOLNPGM("SD benchmark random avg_us:", total_us / n, " max_us:", max_us);
+  }
+
+#endif // SD_IO_STATS
+
+#if ENABLED(SD_COMPRESSED_PRINTING)
+
+  /**
+   * Compressed G-code file layout, all values little-endian:
+   *   Header: "HSGC" <version> <window bits> <lookahead bits> <reserved> <uncompressed size:4>
+   *   Blocks: <compressed size:2> <uncompressed size:2> <heatshrink data>
+   * Each block is compressed independently so seeking only has to
+   * decode from the start of the block containing the new position.
+   * Blocks are found from the nearest one already passed, not from the start.
+   */
+  #define HS_HEADER_SIZE  12
+  #define HS_FILE_VERSION  1
+
+  inline uint16_t hs_le16(const uint8_t * const b) { return b[0] | (uint16_t(b[1]) << 8); }
+
+  /**
+   * Check the newly-opened file for a compressed G-code header.
+   * On success the file size and index refer to the uncompressed data.
+   * Return 'false' for a compressed file that can't be decoded.
+   */
+  bool CardReader::hs_open() {
+    flag.compressed = false;
+
+    uint8_t hdr[HS_HEADER_SIZE];
+    if (raw_read(hdr, HS_HEADER_SIZE) != HS_HEADER_SIZE || hdr[0] != 'H' || hdr[1] != 'S' || hdr[2] != 'G' || hdr[3] != 'C') {
+      raw_seek(0);                          // A plain G-code file
+      return true;
+    }
+
+    if (hdr[4] != HS_FILE_VERSION || hdr[5] != HEATSHRINK_STATIC_WINDOW_BITS || hdr[6] != HEATSHRINK_STATIC_LOOKAHEAD_BITS) {
+      SERIAL_ERROR_MSG("Unsupported compression ", hdr[4], ",", hdr[5], ",", hdr[6]);
+      return false;
+    }
+
+    flag.compressed = true;
+    filesize = hs_le16(&hdr[8]) | (uint32_t(hs_le16(&hdr[10])) << 16);
+    hs_block.pos = 0;
+    ZERO(hs_index);
+    hs_seek(0);
+    return true;
+  }
+
+  // Note the block starting at sdpos, and keep the first one in each part of the file for seeking
+  void CardReader::hs_mark(const uint32_t pos) {
+    hs_block.pos = pos;
+    hs_block.start = sdpos;
+    hs_mark_t &m = hs_index[_MIN(sdpos / (filesize / HS_INDEX_SIZE + 1), uint32_t(HS_INDEX_SIZE - 1))];
+    if (!m.pos) m = hs_block;
+  }
+
+  // Read the next block header and prepare the decoder for the block
+  bool CardReader::hs_next_block() {
+    uint8_t hdr[4];
+    const uint32_t pos = raw_position();
+    if (raw_read(hdr, sizeof(hdr)) != sizeof(hdr)) return false;
+    hs_mark(pos);
+    heatshrink_decoder_reset(&sd_hsd);
+    hs_block_remain = hs_le16(&hdr[0]);
+    return true;
+  }
+
+  // Decompress more characters into hs_out, reading from the file as needed
+  bool CardReader::hs_fill() {
+    hs_out_index = hs_out_count = 0;
+    for (;;) {
+      size_t count;
+      heatshrink_decoder_poll(&sd_hsd, hs_out, sizeof(hs_out), &count);
+      if (count) { hs_out_count = count; return true; }
+
+      if (!hs_block_remain) {
+        if (!hs_next_block()) return false;
+        continue;
+      }
+
+      // The decoder input is empty so it can take a whole buffer
+      uint8_t buf[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE];
+      const int16_t nr = raw_read(buf, _MIN(uint16_t(sizeof(buf)), hs_block_remain));
+      if (nr <= 0) return false;
+      heatshrink_decoder_sink(&sd_hsd, buf, nr, &count);
+      hs_block_remain -= nr;
+    }
+  }
+
+  int16_t CardReader::hs_get() {
+    if (hs_out_index >= hs_out_count && !hs_fill()) {
+      if (sdpos < filesize) SERIAL_ERROR_MSG(STR_SD_ERR_READ);
+      sdpos = filesize;                     // Truncated or corrupt. End the print here.
+      return -1;
+    }
+    ++sdpos;
+    return hs_out[hs_out_index++];
+  }
+
+  /**
+   * Seek to an uncompressed index by skipping whole blocks
+   * then decoding up to the index within the last block.
+   * Start from the closest known block at or before the index.
+   */
+  void CardReader::hs_seek(const uint32_t index) {
+    hs_mark_t from = { HS_HEADER_SIZE, 0 };
+    if (hs_block.pos && hs_block.start <= index) from = hs_block;
+    LOOP_L_N(i, HS_INDEX_SIZE) {
+      const hs_mark_t &m = hs_index[i];
+      if (m.pos && m.start <= index && m.start > from.start) from = m;
+    }
+
+    raw_seek(from.pos);
+    sdpos = from.start;
+    hs_block_remain = hs_out_count = hs_out_index = 0;
+    heatshrink_decoder_reset(&sd_hsd);
+
+    uint8_t hdr[4];
+    for (;;) {
+      const uint32_t pos = raw_position();
+      if (raw_read(hdr, sizeof(hdr)) != sizeof(hdr)) break;
+      const uint16_t csize = hs_le16(&hdr[0]), rsize = hs_le16(&hdr[2]);
+      hs_mark(pos);
+      if (sdpos + rsize > index) { hs_block_remain = csize; break; }
+      sdpos += rsize;
+      raw_seek(pos + sizeof(hdr) + csize);
+    }
+
+    while (sdpos < index && hs_get() >= 0) { /* skip */ }
+  }
+
+#endif // SD_COMPRESSED_PRINTING
+
+#if ENABLED(SD_WRITE_BEHIND)
+
+  /**
+   * Buffer data for the file being written. When the buffers are full
+   * they're written out as whole blocks with multi-block writes.
+   */
+  int16_t CardReader::wb_write(const void *buf, const uint16_t nbyte) {
+    const uint8_t *src = (const uint8_t*)buf;
+    for (uint16_t left = nbyte; left;) {
+      const uint16_t n = _MIN(left, uint16_t(sizeof(wb_buffer) - wb_used));
+      memcpy(&wb_buffer[0][0] + wb_used, src, n);
+      wb_used += n;
+      src += n;
+      left -= n;
+      if (wb_used == sizeof(wb_buffer) && !write_flush()) {
+        file.writeError = true;
+        return -1;
+      }
+    }
+    return nbyte;
+  }
+
+  /**
+   * Write out all buffered data. Whole blocks go straight to the card, in
+   * runs of contiguous blocks. A final partial block goes through the cache.
+   */
+  bool CardReader::write_flush() {
+    const uint8_t blocks = wb_used >> 9;
+    uint8_t done = 0;
+    while (done < blocks) {
+      const uint8_t *src[SD_WRITE_BEHIND_BLOCKS];
+      LOOP_L_N(i, blocks - done) src[i] = wb_buffer[done + i];
+      const int8_t n = file.writeBlocks(src, blocks - done);
+      if (n <= 0) break;  // Leave the rest to write()
+      done += n;
+    }
+    const uint16_t rest = wb_used - (uint16_t(done) << 9);
+    wb_used = 0;
+    return !rest || file.write(wb_buffer[done], rest) == int16_t(rest);
+  }
+
+  /**
+   * Allocate contiguous clusters for the file being written, when the final
+   * size is known in advance (e.g., binary file transfer). Unused clusters
+   * are freed when the file is closed, or by reclaim_preallocated() before
+   * the first write after the next mount if it never was.
+   */
+  bool CardReader::preallocate(const uint32_t size) {
+    wb_preallocated = flag.saving && file.preAllocate(size);
+    return wb_preallocated;
+  }
+
+  /**
+   * Free the clusters of files whose write was cut short by a power loss or
+   * reset. A preallocated file only gets its size when it's closed, so until
+   * then the directory has it at size 0 while it holds the whole allocation.
+   * Truncate such files, as a disk check would. Folders are walked to
+   * MAX_DIR_DEPTH, so this waits for the first file write after a mount
+   * instead of slowing down every mount.
+   */
+  void CardReader::reclaim_preallocated(SdFile &dir, const uint8_t depth/*=0*/) {
+    dir_t p;
+    dir.rewind();
+    while (dir.readDir(&p, nullptr) > 0) {
+      const uint16_t index = dir.curPosition() / 32 - 1;
+      if (DIR_IS_SUBDIR(&p)) {
+        SdFile child;
+        if (depth < MAX_DIR_DEPTH && child.open(&dir, index, O_READ))
+          reclaim_preallocated(child, depth + 1);
+      }
+      else if (DIR_IS_FILE(&p) && !p.fileSize && (p.firstClusterLow || p.firstClusterHigh)) {
+        SdFile lost;
+        if (lost.open(&dir, index, O_WRITE) && lost.truncate(0) && lost.close())
+          SERIAL_ECHO_MSG(STR_SD_FREED_UNFINISHED, createFilename(filename, p));
+      }
+      dir.seekSet(32UL * (index + 1));
+    }
+  }
+
+#endif // SD_WRITE_BEHIND
+
 inline void echo_write_to_file(const char * const fname) {
   SERIAL_ECHOLNPGM(STR_SD_WRITE_TO_FILE, fname);
 }
@@ -710,6 +1314,13 @@ void CardReader::openFileWrite(const char * const path) {
 
   abortFilePrintNow();
 
+  #if ENABLED(SD_WRITE_BEHIND) && DISABLED(SDCARD_READONLY)
+    if (!wb_reclaimed) {
+      wb_reclaimed = true;
+      reclaim_preallocated(root);
+    }
+  #endif
+
   SdFile *diveDir;
   const char * const fname = diveToFile(false, diveDir, path);
   if (!fname) return;
@@ -719,6 +1330,10 @@ void CardReader::openFileWrite(const char * const path) {
   #else
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      #if ENABLED(SD_WRITE_BEHIND)
+        wb_used = 0;
+        wb_preallocated = false;
+      #endif
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -803,7 +1418,12 @@ void CardReader::write_command(char * const buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
-  file.write(begin);
+  #if ENABLED(SD_WRITE_BEHIND)
+    if (!flag.logging)  // Logs are written right away
+      wb_write(begin, strlen(begin));
+    else
+  #endif
+      file.write(begin);
 
   if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
 }
@@ -852,11 +1472,22 @@ void CardReader::write_command(char * const buf) {
 #endif
 
 void CardReader::closefile(const bool store_location/*=false*/) {
+  #if ENABLED(SDSORT_INDEX)
+    const bool was_saving = flag.saving;
+  #endif
+  #if ENABLED(SD_WRITE_BEHIND)
+    if (file.isOpen() && !write_flush()) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+    if (wb_preallocated) {
+      wb_preallocated = false;
+      file.truncate(file.fileSize());  // Free the clusters that weren't used
+    }
+  #endif
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
+  TERN_(SDSORT_INDEX, if (was_saving) presort()); // Update the index with the new file
 
   if (store_location) {
     //future: store printer state, filename and position for continuing a stopped print
@@ -1044,10 +1675,221 @@ void CardReader::cdroot() {
    * Get the name of a file in the working directory by sort-index
    */
   void CardReader::getfilename_sorted(const uint16_t nr) {
+    #if ENABLED(SDSORT_INDEX)
+      if (sort_index.isOpen()) {
+        if (nr >= sort_count || !sort_index_select(nr)) selectFileByIndex(nr);
+        return;
+      }
+    #endif
     selectFileByIndex(TERN1(SDSORT_GCODE, sort_alpha) && (nr < sort_count)
       ? sort_order[nr] : nr);
   }
 
+  #if ENABLED(SDSORT_INDEX)
+
+    /**
+     * Sorted index of a folder, kept in a file in the folder
+     *
+     * The header holds a hash of the folder's visible entries, so the index
+     * is rebuilt whenever the folder is changed, on the printer or elsewhere.
+     * Entries are fixed-size records in sorted order, so any page of the
+     * listing can be read without scanning the folder.
+     */
+    #define SORT_INDEX_TEMP "SORTINDX.TMP"
+    #define SORT_INDEX_VERSION 2
+
+    struct sort_index_header_t {
+      char magic[4];        // "MSIX"
+      uint8_t version;
+      int8_t folders;       // Folder sorting used to build the index
+      uint16_t entry_size;  // Size of each entry
+      uint16_t count;       // Number of entries
+      uint32_t hash;        // Hash of the folder's visible entries
+    };
+
+    struct sort_index_entry_t {
+      uint8_t flags;        // Bit 0: Folder, Bit 1: Binary file
+      char filename[FILENAME_LENGTH];
+      uint32_t size;
+      uint16_t date, time;
+      char longname[LONG_FILENAME_LENGTH];
+    };
+
+    static constexpr uint32_t sort_index_pos(const uint16_t nr) {
+      return sizeof(sort_index_header_t) + uint32_t(nr) * sizeof(sort_index_entry_t);
+    }
+
+    // FNV-1a hash
+    static void sort_index_hash(uint32_t &hash, const void * const data, const size_t len) {
+      const uint8_t *b = (const uint8_t*)data;
+      LOOP_L_N(i, len) { hash ^= b[i]; hash *= 16777619UL; }
+    }
+
+    // Sort order of two entries, following the same rules as the RAM sort
+    static bool sort_index_after(const sort_index_entry_t &e1, const sort_index_entry_t &e2, const int8_t folders) {
+      const bool dir1 = TEST(e1.flags, 0), dir2 = TEST(e2.flags, 0);
+      if (folders && dir1 != dir2) return folders > 0 ? dir1 : dir2;
+      return strcasecmp(e1.longname[0] ? e1.longname : e1.filename, e2.longname[0] ? e2.longname : e2.filename) > 0;
+    }
+
+    // Read entry 'nr' of an index file
+    static bool sort_index_read(SdFile &f, const uint16_t nr, sort_index_entry_t &e) {
+      return f.seekSet(sort_index_pos(nr)) && f.read(&e, sizeof(e)) == sizeof(e);
+    }
+
+    // Merge pairs of sorted runs of 'width' entries from one file into another.
+    // Both runs are read from the same file by seeking to the next entry of each.
+    static bool sort_index_merge(SdFile &src, SdFile &dst, const uint16_t count, const uint16_t width, const int8_t folders) {
+      sort_index_entry_t e1, e2;
+      if (!dst.seekSet(sort_index_pos(0))) return false;
+      for (uint32_t lo = 0; lo < count; lo += 2 * width) {
+        const uint16_t mid = _MIN(lo + width, count), hi = _MIN(lo + 2 * width, count);
+        uint16_t i1 = lo, i2 = mid;
+        if (!sort_index_read(src, i1, e1)) return false;
+        if (i2 < hi && !sort_index_read(src, i2, e2)) return false;
+        while (i1 < mid || i2 < hi) {
+          const bool take2 = i1 >= mid || (i2 < hi && sort_index_after(e1, e2, folders));
+          if (dst.write(take2 ? &e2 : &e1, sizeof(e1)) != sizeof(e1)) return false;
+          if (take2) {
+            if (++i2 < hi && !sort_index_read(src, i2, e2)) return false;
+          }
+          else if (++i1 < mid && !sort_index_read(src, i1, e1)) return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * Open the sorted index of the working directory, rebuilding it if it's
+     * missing or out of date. The folder is read once to check the hash and
+     * once more to rebuild the index, which is then sorted on the card with
+     * a merge sort, so the only limit is the size of the card.
+     */
+    bool CardReader::sort_index_presort() {
+      const int8_t folders = TERN(HAS_FOLDER_SORTING, TERN(SDSORT_GCODE, sort_folders, FOLDER_SORTING), 0);
+
+      // Hash the visible entries of the folder
+      uint16_t count = 0;
+      uint32_t hash = 2166136261UL;
+      dir_t p;
+      workDir.rewind();
+      while (workDir.readDir(&p, longFilename) > 0) {
+        if (!is_visible_entity(p)) continue;
+        count++;
+        sort_index_hash(hash, p.name, sizeof(p.name));
+        sort_index_hash(hash, &p.fileSize, sizeof(p.fileSize));
+        sort_index_hash(hash, &p.lastWriteDate, sizeof(p.lastWriteDate));
+        sort_index_hash(hash, &p.lastWriteTime, sizeof(p.lastWriteTime));
+        sort_index_hash(hash, longFilename, strlen(longFilename));
+      }
+
+      // Use the existing index if it's current
+      sort_index_header_t hdr;
+      if (sort_index.open(&workDir, SDSORT_INDEX_FILE, O_READ)) {
+        if (sort_index.read(&hdr, sizeof(hdr)) == sizeof(hdr)
+          && !memcmp_P(hdr.magic, PSTR("MSIX"), 4) && hdr.version == SORT_INDEX_VERSION
+          && hdr.folders == folders && hdr.entry_size == sizeof(sort_index_entry_t)
+          && hdr.count == count && hdr.hash == hash
+          && sort_index.fileSize() == sort_index_pos(count)
+        ) {
+          sort_count = count;
+          return true;
+        }
+        sort_index.close();
+      }
+
+      // Don't write to the card during a print. Sort in RAM until it's over.
+      if (IS_SD_PRINTING() || isFileOpen()) { sort_index_deferred = true; return false; }
+
+      // Entries are written unsorted to the file where the last merge pass will start
+      uint8_t passes = 0;
+      for (uint32_t w = 1; w < count; w <<= 1) passes++;
+
+      SdFile index, temp, &first = TEST(passes, 0) ? temp : index, &other = TEST(passes, 0) ? index : temp;
+      if (!index.open(&workDir, SDSORT_INDEX_FILE, O_CREAT | O_RDWR | O_TRUNC)) return false;
+      if (passes && !temp.open(&workDir, SORT_INDEX_TEMP, O_CREAT | O_RDWR | O_TRUNC)) { index.remove(); return false; }
+
+      // Start with an empty header. The real one is written last so an interrupted build is never used.
+      memset(&hdr, 0, sizeof(hdr));
+      bool ok = index.write(&hdr, sizeof(hdr)) == sizeof(hdr) && (!passes || temp.write(&hdr, sizeof(hdr)) == sizeof(hdr));
+      uint16_t nr = 0;
+      workDir.rewind();
+      while (ok && nr < count && workDir.readDir(&p, longFilename) > 0) {
+        if (!is_visible_entity(p)) continue;
+        sort_index_entry_t e;
+        e.flags = (flag.filenameIsDir ? _BV(0) : 0) | (fileIsBinary() ? _BV(1) : 0);
+        createFilename(e.filename, p);
+        e.size = p.fileSize;
+        e.date = p.lastWriteDate;
+        e.time = p.lastWriteTime;
+        strncpy(e.longname, longFilename, sizeof(e.longname));
+        ok = first.write(&e, sizeof(e)) == sizeof(e);
+        nr++;
+      }
+      ok = ok && nr == count;
+
+      // Merge runs of 1, 2, 4... entries back and forth, ending in the index file
+      SdFile *src = &first, *dst = &other;
+      for (uint32_t w = 1; ok && w < count; w <<= 1) {
+        ok = src->sync() && sort_index_merge(*src, *dst, count, w, folders);
+        SdFile * const t = src; src = dst; dst = t;
+      }
+
+      if (passes) temp.remove();
+
+      memcpy_P(hdr.magic, PSTR("MSIX"), 4);
+      hdr.version = SORT_INDEX_VERSION;
+      hdr.folders = folders;
+      hdr.entry_size = sizeof(sort_index_entry_t);
+      hdr.count = count;
+      hdr.hash = hash;
+      ok = ok && index.seekSet(0) && index.write(&hdr, sizeof(hdr)) == sizeof(hdr) && index.close();
+      if (!ok) { if (index.isOpen()) index.remove(); else index.remove(&workDir, SDSORT_INDEX_FILE); return false; }
+
+      if (!sort_index.open(&workDir, SDSORT_INDEX_FILE, O_READ)) return false;
+      sort_count = count;
+      return true;
+    }
+
+    // Select an item in the working directory by its place in the sorted index
+    bool CardReader::sort_index_select(const uint16_t nr) {
+      sort_index_entry_t e;
+      if (!sort_index_read(sort_index, nr, e)) return false;
+      strcpy(filename, e.filename);
+      strncpy(longFilename, e.longname, sizeof(longFilename));
+      flag.filenameIsDir = TEST(e.flags, 0);
+      setBinFlag(TEST(e.flags, 1));
+      return true;
+    }
+
+    /**
+     * List a folder from its open index, as printListing() would but in sorted
+     * order. The folder is only read for its subfolders.
+     * Return 'false' if the index can't be read.
+     */
+    bool CardReader::sort_index_ls(SdFile &dir
+      OPTARG(CUSTOM_FIRMWARE_UPLOAD, const bool onlyBin)
+      OPTARG(LONG_FILENAME_HOST_SUPPORT, const bool includeLongNames)
+    ) {
+      if (!sort_index.isOpen()) return false;
+      sort_index_entry_t e;
+      for (uint16_t nr = 0; nr < sort_count; ++nr) {
+        if (!sort_index_read(sort_index, nr, e)) return nr > 0;
+        strncpy(longFilename, e.longname, sizeof(longFilename));
+        if (TEST(e.flags, 0)) {
+          if (!printListingFolder(dir, e.filename, nullptr
+            OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin)
+            OPTARG(LONG_FILENAME_HOST_SUPPORT, includeLongNames, nullptr)
+          )) break;
+        }
+        else if (TERN1(CUSTOM_FIRMWARE_UPLOAD, !onlyBin || TEST(e.flags, 1)))
+          printListingFile(e.filename, e.size, nullptr OPTARG(LONG_FILENAME_HOST_SUPPORT, includeLongNames, nullptr));
+      }
+      return true;
+    }
+
+  #endif // SDSORT_INDEX
+
   #if ENABLED(SDSORT_USES_RAM)
     #if ENABLED(SDSORT_DYNAMIC_RAM)
       // Use dynamic method to copy long filename
@@ -1089,10 +1931,14 @@ void CardReader::cdroot() {
 
     // Throw away old sort index
     flush_presort();
+    TERN_(SDSORT_INDEX, sort_index_deferred = false);
 
     // Sorting may be turned off
     if (TERN0(SDSORT_GCODE, !sort_alpha)) return;
 
+    // Use the index on the card, unless it can't be written
+    if (TERN0(SDSORT_INDEX, sort_index_presort())) return;
+
     // If there are files, sort up to the limit
     uint16_t fileCnt = countFilesInWorkDir();
     if (fileCnt > 0) {
@@ -1253,6 +2099,7 @@ void CardReader::cdroot() {
   }
 
   void CardReader::flush_presort() {
+    TERN_(SDSORT_INDEX, if (sort_index.isOpen()) sort_index.close());
     if (sort_count > 0) {
       #if ENABLED(SDSORT_DYNAMIC_RAM)
         delete [] sort_order;
@@ -1273,6 +2120,9 @@ void CardReader::cdroot() {
 
 uint16_t CardReader::get_num_Files() {
   if (!isMounted()) return 0;
+  #if ENABLED(SDSORT_INDEX)
+    if (sort_index.isOpen()) return sort_count; // no need to read the folder
+  #endif
   return (
     #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
       nrFiles // no need to access the SD card for filenames
@@ -1310,6 +2160,8 @@ void CardReader::fileHasFinished() {
 #if ENABLED(POWER_LOSS_RECOVERY)
 
   bool CardReader::jobRecoverFileExists() {
+    if (!isMounted()) return false;
+    if (recovery.file.isOpen()) return true;  // Kept open by the journal
     const bool exists = recovery.file.open(&root, recovery.filename, O_READ);
     if (exists) recovery.file.close();
     return exists;
@@ -1318,7 +2170,7 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : TERN(POWER_LOSS_JOURNAL, O_CREAT | O_RDWR, O_CREAT | O_WRITE | O_TRUNC | O_SYNC)))
       openFailed(recovery.filename);
     else if (!read)
       echo_write_to_file(recovery.filename);
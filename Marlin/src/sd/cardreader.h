@@ -46,6 +46,10 @@ extern const char M23_STR[], M24_STR[];
 #define MAXDIRNAMELENGTH   8       // DOS folder name size
 #define MAXPATHNAMELENGTH  (1 + (MAXDIRNAMELENGTH + 1) * (MAX_DIR_DEPTH) + 1 + FILENAME_LENGTH) // "/" + N * ("ADIRNAME/") + "filename.ext"
 
+#if ENABLED(SD_PREFETCH_CACHE)
+  #define PF_BURST 8               // Blocks per prefetch card read, one 4K flash sector
+#endif
+
 #include "SdFile.h"
 #include "disk_io_driver.h"
 
@@ -53,8 +57,14 @@ extern const char M23_STR[], M24_STR[];
   #include "usb_flashdrive/Sd2Card_FlashDrive.h"
 #endif
 
+#if ENABLED(SD_IO_STATS)
+  #include "SdStats.h"
+#endif
+
 #if NEED_SD2CARD_SDIO
   #include "Sd2Card_sdio.h"
+#elif NEED_SD2CARD_FILE
+  #include HAL_PATH(../HAL, Sd2Card_file.h)
 #elif NEED_SD2CARD_SPI
   #include "Sd2Card.h"
 #endif
@@ -86,6 +96,9 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(SD_COMPRESSED_PRINTING)
+         , compressed:1
+       #endif
     ;
 } card_flags_t;
 
@@ -236,14 +249,42 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #if ENABLED(SD_COMPRESSED_PRINTING)
+    static int16_t get()                          { return flag.compressed ? hs_get() : raw_get(); }
+    static void setIndex(const uint32_t index)    { if (flag.compressed) hs_seek(index); else raw_seek((sdpos = index)); }
+  #else
+    static int16_t get()                          { return raw_get(); }
+    static void setIndex(const uint32_t index)    { raw_seek((sdpos = index)); }
+  #endif
+  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? raw_read(buf, nbyte) : -1; }
+
+  #if ENABLED(SD_EXTENT_CACHE)
+    // The cluster of a print index, saved by Power-Loss Recovery to seek back there after a reboot
+    static uint32_t fileFirstCluster()                  { return file.firstCluster(); }
+    static uint32_t indexCluster(const uint32_t index)  { return TERN0(SD_COMPRESSED_PRINTING, flag.compressed) ? 0 : file.mappedCluster(index & ~0x1FFUL); }
+    static void hintIndexCluster(const uint32_t index, const uint32_t cluster) {
+      if (!TERN0(SD_COMPRESSED_PRINTING, flag.compressed)) file.hintCluster(index & ~0x1FFUL, cluster);
+    }
+  #endif
+
+  #if ENABLED(SD_READ_AHEAD)
+    static void read_ahead() { if (flag.sdprinting && (ENABLED(SD_PREFETCH_CACHE) || ra_count < SD_READ_AHEAD_BLOCKS) && isFileOpen()) ra_fill(); }
+  #endif
+  #if ENABLED(SD_WRITE_BEHIND)
+    static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? wb_write(buf, nbyte) : -1; }
+    static bool write_flush();
+    static bool preallocate(const uint32_t size);
+  #else
+    static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  #endif
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
 
+  #if ENABLED(SD_IO_STATS)
+    static void read_benchmark(const uint16_t count);
+  #endif
+
   #if ENABLED(AUTO_REPORT_SD_STATUS)
     //
     // SD Auto Reporting
@@ -257,7 +298,10 @@ public:
     static DiskIODriver_USBFlash media_driver_usbFlash;
   #endif
 
-  #if NEED_SD2CARD_SDIO || NEED_SD2CARD_SPI
+  #if NEED_SD2CARD_FILE
+    typedef DiskIODriver_File sdcard_driver_t;
+    static sdcard_driver_t media_driver_sdcard;
+  #elif NEED_SD2CARD_SDIO || NEED_SD2CARD_SPI
     typedef TERN(NEED_SD2CARD_SDIO, DiskIODriver_SDIO, DiskIODriver_SPI_SD) sdcard_driver_t;
     static sdcard_driver_t media_driver_sdcard;
   #endif
@@ -287,6 +331,15 @@ private:
       static uint8_t sort_order[SDSORT_LIMIT];
     #endif
 
+    // Sorted index file on the card, for the working directory
+    #if ENABLED(SDSORT_INDEX)
+      static SdFile sort_index;
+      static bool sort_index_deferred;  // The index is out of date, to be rewritten after the print
+      static bool sort_index_presort();
+      static bool sort_index_select(const uint16_t nr);
+      static bool sort_index_ls(SdFile &dir OPTARG(CUSTOM_FIRMWARE_UPLOAD, const bool onlyBin) OPTARG(LONG_FILENAME_HOST_SUPPORT, const bool includeLongNames));
+    #endif
+
     #if BOTH(SDSORT_USES_RAM, SDSORT_CACHE_NAMES) && DISABLED(SDSORT_DYNAMIC_RAM)
       #define SORTED_LONGNAME_MAXLEN (SDSORT_CACHE_VFATS) * (FILENAME_LENGTH)
       #define SORTED_LONGNAME_STORAGE (SORTED_LONGNAME_MAXLEN + 1)
@@ -332,6 +385,93 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  //
+  // Read-ahead buffers for the file being printed
+  //
+  #if ENABLED(SD_READ_AHEAD)
+    static uint8_t ra_buffer[SD_READ_AHEAD_BLOCKS][512];
+    static uint8_t ra_head,   // Buffer being read
+                   ra_count;  // Number of filled buffers
+    static bool ra_pending;   // An asynchronous read into the next buffer is in progress
+    static bool ra_retry;     // The last asynchronous read failed and ra_block must be read again
+    static uint32_t ra_block; // Card block of the last asynchronous read
+    static uint16_t ra_index; // Next byte in the head buffer
+    static uint32_t ra_pos;   // File position of the next byte
+    static void ra_reset();
+    static bool ra_complete(const bool wait);
+    static bool ra_fill(const bool wait=false);
+    static bool ra_ready();
+    static void ra_seek(const uint32_t pos);
+    static int16_t ra_read(void *buf, uint16_t nbyte);
+    static uint32_t ra_next_block() { return ((ra_pos - ra_index) >> 9) + ra_count; } // File block for the next empty buffer
+    static int16_t ra_get() {
+      if (ra_pos >= file.fileSize() || !ra_ready()) return -1;
+      const uint8_t c = ra_buffer[ra_head][ra_index];
+      if (++ra_index == 512) { ra_index = 0; ra_head = (ra_head + 1) % (SD_READ_AHEAD_BLOCKS); --ra_count; }
+      ++ra_pos;
+      return c;
+    }
+    static int16_t raw_get()                            { const int16_t out = ra_get(); sdpos = ra_pos; return out; }
+    static int16_t raw_read(void *buf, uint16_t nbyte)  { return ra_read(buf, nbyte); }
+    static void raw_seek(const uint32_t pos)            { ra_seek(pos); }
+    static uint32_t raw_position()                      { return ra_pos; }
+
+    //
+    // Ring cache holding file blocks pf_first to pf_end - 1, ahead of the read-ahead buffers
+    //
+    #if ENABLED(SD_PREFETCH_CACHE)
+      #if ENABLED(SD_PREFETCH_SPI_FLASH)
+        static uint8_t pf_stage[PF_BURST][512]; // Blocks read from the card, being programmed into the flash
+        static uint8_t pf_staged,         // Number of staged blocks, which follow pf_end
+                       pf_pages;          // Number of staged pages already programmed
+        static bool pf_flash_ready;       // The SPI flash has been initialized
+      #else
+        static uint8_t pf_ring[(SD_PREFETCH_RAM_SIZE) / 512][512];
+      #endif
+      static uint32_t pf_first, pf_end;
+      static void pf_reset(const uint32_t block) { pf_first = pf_end = block; TERN_(SD_PREFETCH_SPI_FLASH, pf_staged = pf_pages = 0); }
+      static bool pf_fill(const uint32_t next);
+      static bool pf_take(const uint32_t block, uint8_t * const dst, const bool wait);
+    #endif
+  #else
+    static int16_t raw_get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+    static int16_t raw_read(void *buf, uint16_t nbyte)  { return file.read(buf, nbyte); }
+    static void raw_seek(const uint32_t pos)            { file.seekSet(pos); }
+    static uint32_t raw_position()                      { return file.curPosition(); }
+  #endif
+
+  //
+  // Write-behind buffers for the file being written
+  //
+  #if ENABLED(SD_WRITE_BEHIND)
+    static uint8_t wb_buffer[SD_WRITE_BEHIND_BLOCKS][512];
+    static uint16_t wb_used;        // Bytes waiting to be written
+    static bool wb_preallocated;    // Clusters were allocated for the expected size
+    static bool wb_reclaimed;       // Unfinished files were looked for since the mount
+    static int16_t wb_write(const void *buf, const uint16_t nbyte);
+    static void reclaim_preallocated(SdFile &dir, const uint8_t depth=0);
+  #endif
+
+  //
+  // Heatshrink-compressed G-code files
+  //
+  #if ENABLED(SD_COMPRESSED_PRINTING)
+    #define HS_INDEX_SIZE 16
+    typedef struct { uint32_t pos, start; } hs_mark_t; // File position of a block header and uncompressed index of the block
+    static hs_mark_t hs_block,        // The block being decoded
+                     hs_index[HS_INDEX_SIZE]; // The first block seen in each 1/16 of the file, for seeking
+    static uint16_t hs_block_remain;  // Compressed bytes not yet fed to the decoder
+    static uint8_t hs_out[32],        // Decompressed characters
+                   hs_out_count,      // Number of characters in hs_out
+                   hs_out_index;      // Next character to return from hs_out
+    static bool hs_open();
+    static void hs_mark(const uint32_t pos);
+    static bool hs_next_block();
+    static bool hs_fill();
+    static int16_t hs_get();
+    static void hs_seek(const uint32_t index);
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -354,6 +494,17 @@ private:
     OPTARG(LONG_FILENAME_HOST_SUPPORT, const bool includeLongNames=false)
     OPTARG(LONG_FILENAME_HOST_SUPPORT, const char * const prependLong=nullptr)
   );
+  static bool printListingFolder(
+    SdFile &parent, const char * const dosname, const char * const prepend
+    OPTARG(CUSTOM_FIRMWARE_UPLOAD, const bool onlyBin)
+    OPTARG(LONG_FILENAME_HOST_SUPPORT, const bool includeLongNames)
+    OPTARG(LONG_FILENAME_HOST_SUPPORT, const char * const prependLong)
+  );
+  static void printListingFile(
+    const char * const dosname, const uint32_t size, const char * const prepend
+    OPTARG(LONG_FILENAME_HOST_SUPPORT, const bool includeLongNames)
+    OPTARG(LONG_FILENAME_HOST_SUPPORT, const char * const prependLong)
+  );
 
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void flush_presort();
@@ -23,6 +23,14 @@
 
 #include <stdint.h>
 
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(SD_READ_AHEAD)
+  // Status of an asynchronous read
+  enum DiskIOStatus : int8_t { DISKIO_ERROR = -1, DISKIO_IDLE, DISKIO_BUSY, DISKIO_DONE };
+  typedef void (*diskio_callback_t)(const bool success);
+#endif
+
 /**
  * DiskIO Interface
  *
@@ -64,4 +72,47 @@ public:
   virtual bool isReady() = 0;
 
   virtual void idle() = 0;
+
+  #if ENABLED(SD_READ_AHEAD)
+    /**
+     * Asynchronous block read
+     *
+     * Start reading a block into dst and return without waiting. Use pollRead()
+     * to get the status. DISKIO_DONE or DISKIO_ERROR is returned once, also
+     * calling the callback, if any. Then the status goes back to DISKIO_IDLE.
+     * The buffer must not be used until the read is complete. Other driver
+     * calls made while a read is in progress wait for it to complete.
+     *
+     * Drivers without asynchronous (e.g., DMA) transfers use the default,
+     * which completes the read before returning. asyncRead() tells which.
+     *
+     * \return false if the read could not be started.
+     */
+    virtual bool asyncRead() { return false; }
+
+    virtual bool readBlockAsync(const uint32_t block, uint8_t *dst, diskio_callback_t callback=nullptr) {
+      async_callback = callback;
+      async_status = readBlock(block, dst) ? DISKIO_DONE : DISKIO_ERROR;
+      return true;
+    }
+
+    virtual DiskIOStatus pollRead() { return finishRead(async_status); }
+
+  protected:
+    DiskIOStatus async_status = DISKIO_IDLE;
+    diskio_callback_t async_callback = nullptr;
+
+    // Report a finished read once, then return to idle
+    DiskIOStatus finishRead(const DiskIOStatus status) {
+      if (status == DISKIO_DONE || status == DISKIO_ERROR) {
+        async_status = DISKIO_IDLE;
+        if (async_callback) {
+          const diskio_callback_t callback = async_callback;
+          async_callback = nullptr;
+          callback(status == DISKIO_DONE);
+        }
+      }
+      return status;
+    }
+  #endif
 };
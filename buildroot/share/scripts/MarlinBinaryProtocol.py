@@ -4,6 +4,7 @@
 #
 import serial
 import math
+import struct
 import time
 from collections import deque
 import threading
@@ -342,10 +343,15 @@ class FileTransferProtocol(object):
 
         print("File Transfer version: {0}, compression: {1}".format(self.version, self.compression['algorithm']))
 
-    def open(self, filename, compression, dummy):
+    def version_tuple(self):
+        return tuple(int(v) for v in self.version.split('.')[:2])
+
+    def open(self, filename, compression, dummy, filesize=None):
         payload =  b'\1' if dummy else b'\0'          # dummy transfer
         payload += b'\1' if compression else b'\0'    # payload compression
         payload += bytearray(filename, 'utf8') + b'\0'# target filename + null terminator
+        if filesize is not None and self.version_tuple() >= (0, 2):
+            payload += struct.pack('<I', filesize)    # uncompressed file size, for pre-allocation
 
         timeout = TimeOut(5000)
         token = None
@@ -401,7 +407,7 @@ class FileTransferProtocol(object):
         data = open(filename, "rb").read()
         filesize = len(data)
 
-        self.open(dest_filename, compression_support, dummy)
+        self.open(dest_filename, compression_support, dummy, filesize)
 
         block_size = self.protocol.block_size
         if compression_support:
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+Compress a G-code file for printing with SD_COMPRESSED_PRINTING.
+
+The output is a heatshrink stream (window 8, lookahead 4) split into blocks that are
+compressed independently, so the firmware can seek by decoding from a block start.
+
+  Header: "HSGC" <version> <window bits> <lookahead bits> <reserved> <uncompressed size:4>
+  Blocks: <compressed size:2> <uncompressed size:2> <heatshrink data>
+
+Usage: gcode_compress.py [-b BLOCK_SIZE] [-s] input.gcode [output.hs]
+"""
+
+import argparse, os, struct
+
+WINDOW_BITS = 8     # Must match HEATSHRINK_STATIC_WINDOW_BITS
+LOOKAHEAD_BITS = 4  # Must match HEATSHRINK_STATIC_LOOKAHEAD_BITS
+VERSION = 1
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.byte = 0
+        self.bits = 0
+
+    def put(self, value, count):
+        for i in range(count - 1, -1, -1):
+            self.byte = (self.byte << 1) | ((value >> i) & 1)
+            self.bits += 1
+            if self.bits == 8:
+                self.out.append(self.byte)
+                self.byte = self.bits = 0
+
+    def finish(self):
+        if self.bits:
+            self.out.append(self.byte << (8 - self.bits))
+            self.byte = self.bits = 0
+        return bytes(self.out)
+
+def heatshrink_compress(data):
+    """Greedy LZSS encoding in the heatshrink bit format."""
+    window, max_len = 1 << WINDOW_BITS, 1 << LOOKAHEAD_BITS
+    bw = BitWriter()
+    i, n = 0, len(data)
+    while i < n:
+        best_len, best_off = 0, 0
+        start = max(0, i - window)
+        length = 2  # Shorter matches cost more than literals
+        while length <= max_len and i + length <= n:
+            # The match may run on into the lookahead
+            pos = data.rfind(data[i:i + length], start, i + length - 1)
+            if pos < 0: break
+            best_len, best_off = length, i - pos
+            length += 1
+        if best_len:
+            bw.put(0, 1)
+            bw.put(best_off - 1, WINDOW_BITS)
+            bw.put(best_len - 1, LOOKAHEAD_BITS)
+            i += best_len
+        else:
+            bw.put(1, 1)
+            bw.put(data[i], 8)
+            i += 1
+    return bw.finish()
+
+def strip_comments(data):
+    lines = []
+    for line in data.split(b'\n'):
+        line = line.split(b';', 1)[0].rstrip()
+        if line: lines.append(line)
+    return b'\n'.join(lines) + b'\n'
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress G-code for SD_COMPRESSED_PRINTING')
+    parser.add_argument('input')
+    parser.add_argument('output', nargs='?', help='Output file (default: input with .hs extension)')
+    parser.add_argument('-b', '--block-size', type=int, default=4096, help='Uncompressed bytes per block (256-32768)')
+    parser.add_argument('-s', '--strip', action='store_true', help='Strip comments and blank lines')
+    args = parser.parse_args()
+
+    if not 256 <= args.block_size <= 32768:
+        parser.error('block size must be between 256 and 32768')
+
+    with open(args.input, 'rb') as f: data = f.read()
+    if args.strip: data = strip_comments(data)
+
+    output = args.output or os.path.splitext(args.input)[0] + '.hs'
+    with open(output, 'wb') as f:
+        f.write(b'HSGC' + struct.pack('<BBBBI', VERSION, WINDOW_BITS, LOOKAHEAD_BITS, 0, len(data)))
+        total = 12
+        for ofs in range(0, len(data), args.block_size):
+            raw = data[ofs:ofs + args.block_size]
+            packed = heatshrink_compress(raw)
+            f.write(struct.pack('<HH', len(packed), len(raw)) + packed)
+            total += 4 + len(packed)
+
+    print('%s: %d -> %d bytes (%.1f%%)' % (output, len(data), total, 100.0 * total / max(1, len(data))))
+
+if __name__ == '__main__':
+    main()
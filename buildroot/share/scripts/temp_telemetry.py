@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""
+Decode a TEMP_TELEMETRY frame from M156 into CSV.
+
+The input may be TELEMTRY.BIN from the SD card or a capture of the serial output.
+For a capture, the frame is taken from after the "Telemetry:<bytes>" line.
+
+  Header:  "TLM" <version:1> <heaters:1> <samples:1> <heater id:1 x heaters>
+  Samples: <ms:2> { <raw:2> <temp x10:2> <target:2> <pwm:1> } x heaters
+  Trailer: <CRC16-XMODEM of header and samples:2>
+
+Usage: temp_telemetry.py input.bin [output.csv]
+"""
+
+import argparse, re, struct, sys
+
+VERSION = 1
+PWM_MAX = 127
+
+def heater_name(hid):
+    return { -1: 'B', -2: 'C' }.get(hid, 'E%d' % hid)
+
+def crc16(data):
+    crc = 0
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+def find_frame(data):
+    m = re.search(rb'Telemetry:(\d+)\r?\n', data)
+    if m:
+        return data[m.end():m.end() + int(m.group(1))]
+    ofs = data.find(b'TLM')
+    if ofs < 0: raise ValueError('no telemetry frame found')
+    return data[ofs:]
+
+def decode(frame):
+    if frame[:3] != b'TLM': raise ValueError('bad frame magic')
+    version, heaters, count = frame[3], frame[4], frame[5]
+    if version != VERSION: raise ValueError('unsupported version %d' % version)
+    ids = struct.unpack_from('<%db' % heaters, frame, 6)
+    ofs = 6 + heaters
+    size = 2 + 7 * heaters
+    end = ofs + count * size
+    if len(frame) < end + 2: raise ValueError('frame is truncated')
+    crc, = struct.unpack_from('<H', frame, end)
+    if crc != crc16(frame[:end]): raise ValueError('CRC mismatch')
+
+    rows, ms, last = [], 0, None
+    for i in range(count):
+        p = ofs + i * size
+        t, = struct.unpack_from('<H', frame, p)
+        ms = t if last is None else ms + ((t - last) & 0xFFFF)   # Undo the 16-bit wrap
+        last = t
+        row = [ms]
+        for h in range(heaters):
+            raw, temp, target, pwm = struct.unpack_from('<HhhB', frame, p + 2 + 7 * h)
+            row += [raw, temp / 10.0, target, round(100.0 * pwm / PWM_MAX, 1)]
+        rows.append(row)
+    return ids, rows
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode M156 temperature telemetry')
+    parser.add_argument('input')
+    parser.add_argument('output', nargs='?', help='Output CSV file (default: stdout)')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f: data = f.read()
+    try:
+        ids, rows = decode(find_frame(data))
+    except ValueError as e:
+        sys.exit('%s: %s' % (args.input, e))
+
+    cols = ['ms']
+    for hid in ids:
+        n = heater_name(hid)
+        cols += [n + '_raw', n + '_temp', n + '_target', n + '_pwm%']
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    out.write(','.join(cols) + '\n')
+    for row in rows:
+        out.write(','.join(str(v) for v in row) + '\n')
+    if args.output: out.close()
+
+if __name__ == '__main__':
+    main()